@@ -1,10 +1,13 @@
 #pragma once
 #include <vector>
 #include <string>
+#include "run_results.hpp"
 #include "types.hpp" // Include Trade
 
 class MLAnalytics {
 public:
     void classify_strategy(const std::vector<Trade>& trades);
     void detect_regime(const std::vector<Trade>& trades);
+    void classify_strategy(const TradeView& trades); // Zero-copy over columnar run results
+    void detect_regime(const TradeView& trades);
 };
\ No newline at end of file
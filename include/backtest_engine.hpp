@@ -1,7 +1,11 @@
 #pragma once
+#include <span>
 #include <string>
 #include <vector>
 #include "data_manager.hpp"
+#include "indicator_graph.hpp"
+#include "performance_analytics.hpp"
+#include "run_results.hpp"
 #include "strategy_framework.hpp"
 #include "types.hpp" // Include Trade
 
@@ -9,10 +13,21 @@ class BacktestEngine {
 public:
     BacktestEngine(DataManager& data_manager, Strategy& strategy);
     void run_backtest(const std::string& asset);
-    std::vector<Trade> get_trades() const; // Add get_trades
+    void run_variants(const std::string& asset, IndicatorGraph& graph, const std::vector<Strategy*>& variants);
+    std::vector<Trade> get_trades() const; // Materializes a copy; prefer trade_view()
+    TradeView trade_view() const;          // Zero-copy; valid until the next run
+    TradeView get_variant_trades(std::size_t variant) const;
+    const PositionBook& variant_book(std::size_t variant) const; // Scores one variant of the last run_variants
+    const PositionBook& book() const { return book_; } // Last run_backtest's position book
+    std::span<const double> returns() const { return returns_; } // Its per-tick returns, for resampling
 
 private:
     DataManager& data_manager_;
     Strategy& strategy_;
-    std::vector<Trade> trades_;
+    RunArena arena_; // Reset at the start of every run
+    TradeColumns trades_;
+    std::vector<TradeColumns> variant_trades_;
+    std::vector<PositionBook> variant_books_;
+    PositionBook book_;
+    std::vector<double> returns_; // Capacity kept across runs
 };
\ No newline at end of file
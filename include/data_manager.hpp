@@ -3,6 +3,7 @@
 #include <vector>
 #include <map>
 #include <mutex>
+#include <span>
 #include <filesystem>
 #include <fstream>
 #include "types.hpp" // Include Trade, Order, MarketData, and AlternativeData
@@ -18,6 +19,7 @@ public:
     void save_data(const std::string& asset);
     void load_data(const std::string& asset);
     std::vector<MarketData> get_historical_data(const std::string& asset) const;
+    std::span<const MarketData> historical_view(const std::string& asset) const; // No copy; invalidated by ingestion
     std::vector<AlternativeData> get_alternative_data(const std::string& source) const;
 
 private:
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+#include "types.hpp" // Include Order and MarketData
+
+struct DivergenceThresholds {
+    double max_slippage_bps = 10.0;    // Live fill vs. quoted price, adverse direction
+    double max_price_delta_bps = 5.0;  // Live fill vs. shadow fill on the same signal
+    std::size_t max_mismatch_ticks = 3; // Consecutive ticks with differing live/shadow signals
+    double max_pnl_drift = 1000.0;     // |live equity - shadow equity|
+};
+
+struct DivergenceAlert {
+    std::string timestamp;
+    std::string metric;
+    double value;
+    double threshold;
+};
+
+// Threshold breach recorded by a deferred tracker; plain data, so it can cross a SpscRing
+struct DeferredAlert {
+    std::uint8_t metric; // Index into the tracker's metric names
+    double value;
+    double threshold;
+};
+
+// Online live-vs-shadow comparison, updated in O(1) per tick from the two paths' orders
+class DivergenceTracker {
+public:
+    explicit DivergenceTracker(const DivergenceThresholds& thresholds = {});
+    bool on_tick(const MarketData& tick, const Order& live, const Order& shadow); // true if an alert fired
+    void set_alert_handler(std::function<void(const DivergenceAlert&)> handler);
+    void set_deferred(bool deferred); // Queue breaches for raise_deferred() instead of raising in on_tick()
+    std::span<const DeferredAlert> deferred_alerts() const { return {deferred_, deferred_count_}; } // Last tick's
+    void raise_deferred(const DeferredAlert& alert, const std::string& timestamp); // Log, handler, alerts()
+
+    std::uint64_t ticks() const { return ticks_; }
+    std::uint64_t live_fills() const { return live_fills_; }
+    std::uint64_t signal_mismatches() const { return mismatches_; }
+    std::size_t mismatch_run() const { return mismatch_run_; } // Timing delta in ticks
+    double last_slippage_bps() const { return last_slippage_bps_; }
+    double mean_slippage_bps() const { return live_fills_ ? slippage_sum_bps_ / live_fills_ : 0.0; }
+    double mean_price_delta_bps() const { return matched_fills_ ? price_delta_sum_bps_ / matched_fills_ : 0.0; }
+    double live_pnl() const { return live_.equity; }
+    double shadow_pnl() const { return shadow_.equity; }
+    double pnl_drift() const { return live_.equity - shadow_.equity; }
+    const std::vector<DivergenceAlert>& alerts() const { return alerts_; }
+
+private:
+    struct Book {
+        double position = 0.0;
+        double cash = 0.0;
+        double equity = 0.0;
+    };
+    enum Metric { Slippage, PriceDelta, Timing, PnlDrift, MetricCount };
+
+    static double signed_quantity(const Order& order);
+    static void apply(Book& book, const Order& order, double mid);
+    bool check(Metric metric, double value, double threshold, const MarketData& tick);
+
+    DivergenceThresholds thresholds_;
+    std::function<void(const DivergenceAlert&)> handler_;
+    Book live_;
+    Book shadow_;
+    std::uint64_t ticks_ = 0;
+    std::uint64_t live_fills_ = 0;
+    std::uint64_t matched_fills_ = 0;
+    std::uint64_t mismatches_ = 0;
+    std::size_t mismatch_run_ = 0;
+    double last_slippage_bps_ = 0.0;
+    double slippage_sum_bps_ = 0.0;
+    double price_delta_sum_bps_ = 0.0;
+    bool breached_[MetricCount] = {false, false, false, false}; // Edge-triggered alerts
+    bool deferred_mode_ = false;
+    DeferredAlert deferred_[MetricCount] = {}; // At most one breach per metric per tick
+    std::size_t deferred_count_ = 0;
+    std::vector<DivergenceAlert> alerts_;
+};
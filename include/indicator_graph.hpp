@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "types.hpp" // Include MarketData
+
+enum class IndicatorKind { SMA, EMA };
+
+struct IndicatorSpec {
+    IndicatorKind kind;
+    int period;
+};
+
+// Per-asset indicator graph: identical indicator nodes are registered once,
+// advanced once per tick, and read by any number of strategies.
+class IndicatorGraph {
+public:
+    using NodeId = std::size_t;
+
+    explicit IndicatorGraph(const std::string& asset);
+    NodeId require(const IndicatorSpec& spec); // Returns existing node for duplicate specs
+    void update(const MarketData& data);
+    double value(NodeId id) const { return values_[id]; }
+    bool ready(NodeId id) const { return nodes_[id].count >= static_cast<std::uint64_t>(nodes_[id].period); }
+    std::uint64_t ticks() const { return ticks_; }
+    std::size_t node_count() const { return nodes_.size(); }
+    const std::string& asset() const { return asset_; }
+    void save_state(std::ostream& out) const; // Binary snapshot of windows and node values
+    bool load_state(std::istream& in);        // Requires the same nodes to be registered
+
+private:
+    struct Node {
+        IndicatorKind kind;
+        int period;
+        double alpha;        // EMA smoothing factor (unused for SMA)
+        double sum;          // Running window sum (unused for EMA)
+        std::uint64_t count; // Ticks seen since the node was registered
+    };
+
+    void grow_window(std::size_t capacity);
+
+    std::string asset_;
+    std::map<std::pair<int, int>, NodeId> index_;
+    std::vector<Node> nodes_;
+    std::vector<double> values_;
+    std::vector<double> window_; // Shared mid-price ring buffer sized to the longest SMA
+    std::uint64_t ticks_;
+};
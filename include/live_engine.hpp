@@ -1,20 +1,56 @@
 #pragma once
+#include <cstddef>
+#include <deque>
 #include <string>
 #include <vector>
 #include "data_manager.hpp"
+#include "divergence_tracker.hpp"
+#include "low_latency.hpp"
+#include "order_matching.hpp"
+#include "risk_manager.hpp"
 #include "strategy_framework.hpp"
+#include "strategy_scheduler.hpp"
+#include "trade_journal.hpp"
 #include "types.hpp" // Include Trade
 
+// Trade and P&L state of one coroutine-hosted strategy, kept apart from the engine's own
+struct HostedStrategy {
+    std::string asset;
+    Strategy* strategy;
+    std::vector<Trade> trades;
+    double pnl = 0.0;
+};
+
 class LiveEngine {
 public:
+    using HostedId = std::size_t;
+
     LiveEngine(DataManager& data_manager, Strategy& strategy);
-    void run_live(const std::string& asset);
-    std::vector<Trade> get_trades() const; // Add get_trades
+    void run_live(const std::string& asset); // One simulated tick
+    void run_live(const MarketData& data);
+    void run_low_latency(const std::string& asset, RiskManager& risk_manager, const LowLatencyConfig& config);
+    HostedId host(StrategyScheduler& scheduler, const std::string& asset, Strategy& strategy); // Add a coroutine-hosted strategy
+    const HostedStrategy& hosted(HostedId id) const; // Per-strategy trades and P&L
+    std::size_t hosted_count() const { return hosted_.size(); }
+    void attach_journal(TradeJournal* journal); // Journal every order and fill; nullptr detaches
+    void attach_shadow(Strategy* shadow, DivergenceTracker* tracker); // Lockstep simulated replay; nullptr detaches
+    void attach_risk(RiskManager* risk_manager); // Feed every fill to on_trade(); nullptr detaches
+    bool save_snapshot(const std::string& path, const RiskManager& risk_manager) const;
+    bool recover(const std::string& snapshot_path, RiskManager& risk_manager); // Snapshot + journal tail
+    const std::vector<Trade>& get_trades() const; // Read-only; no copy
     double get_pnl() const; // Add get_pnl
 
 private:
+    StrategyScheduler::Task strategy_loop(StrategyScheduler& scheduler, HostedStrategy& state);
+
     DataManager& data_manager_;
     Strategy& strategy_;
     std::vector<Trade> trades_;
     double pnl_;
+    TradeJournal* journal_;
+    Strategy* shadow_;
+    DivergenceTracker* tracker_;
+    RiskManager* risk_manager_;
+    OrderMatchingEngine fill_model_; // Every live fill is priced through its slippage model
+    std::deque<HostedStrategy> hosted_; // Deque: coroutine frames hold references to elements
 };
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+struct LowLatencyConfig {
+    int feed_core = -1;     // -1 leaves the thread unpinned
+    int strategy_core = -1;
+    int risk_core = -1;
+    bool busy_poll = true;  // Spin instead of yielding when a queue is empty
+    bool lock_memory = true;
+    std::size_t prefault_stack_bytes = 256 * 1024;
+    std::size_t queue_capacity = 4096; // Rounded up to a power of two
+    std::size_t trade_capacity = 1 << 16; // ~7 MB of Trade slots; fits a typical RLIMIT_MEMLOCK
+};
+
+struct LowLatencyStatus {
+    bool memory_locked = false;
+    bool feed_pinned = false;
+    bool strategy_pinned = false;
+    bool risk_pinned = false;
+};
+
+namespace low_latency {
+bool pin_current_thread(int core);
+int core_limit(); // Exclusive upper bound on core indices the affinity API can address
+bool lock_process_memory(); // Locks resident pages only; leaves nothing locked on failure
+std::size_t memory_lock_limit(); // RLIMIT_MEMLOCK in bytes; SIZE_MAX if unlimited or unknown
+void prefault_thread(std::size_t stack_bytes);
+long minor_page_faults(); // -1 where unsupported
+void cpu_relax();
+void report_startup(const LowLatencyConfig& config, const LowLatencyStatus& status);
+} // namespace low_latency
+
+// Bounded single-producer/single-consumer ring used between pinned threads
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(std::size_t capacity) {
+        std::size_t size = 1;
+        while (size < capacity) size <<= 1;
+        slots_.resize(size);
+        mask_ = size - 1;
+    }
+
+    bool try_push(const T& value) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) > mask_) return false; // Full
+        slots_[tail & mask_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T& value) {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) return false; // Empty
+        value = slots_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::vector<T> slots_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+};
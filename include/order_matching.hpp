@@ -7,4 +7,5 @@ class OrderMatchingEngine {
 public:
     void match_order(const Order& order, const MarketData& market_data);
     void apply_slippage_and_latency(Order& order) const;
+    void fill(Order& order) const; // Slippage model only, no logging: safe on live hot paths
 };
\ No newline at end of file
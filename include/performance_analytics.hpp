@@ -1,15 +1,80 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <map>
+#include <span>
 #include <string>
 #include <vector>
-#include "types.hpp" // Include Trade
+#include "divergence_tracker.hpp"
+#include "run_results.hpp"
+#include "types.hpp" // Include Trade and Order
+
+// Streaming accumulator for return-series metrics (Welford variance, compounded drawdown)
+class MetricAccumulator {
+public:
+    void add(double ret);
+    double sharpe() const;       // mean / population std dev, as in calculate_metrics
+    double max_drawdown() const; // Largest peak-to-trough loss of the compounded equity curve
+    double total_return() const;
+    std::size_t count() const { return count_; }
+
+private:
+    std::size_t count_ = 0;
+    double mean_ = 0.0;
+    double m2_ = 0.0;
+    double equity_ = 1.0;
+    double peak_ = 1.0;
+    double max_drawdown_ = 0.0;
+};
+
+// Signed position and cash book marked to mid on every tick
+// Why: Scores what a strategy's signals earn; returns of the execution prices alone follow the
+// same underlying price path whatever the strategy does
+struct PositionBook {
+    double capital = 0.0;  // Starting equity (e.g., enough to hold one unit at the first mid)
+    double position = 0.0;
+    double cash = 0.0;
+    double equity = 0.0;   // capital + cash + position * mid as of the last tick; 0 before the first
+    std::uint64_t trades = 0;
+    MetricAccumulator acc; // Every per-tick return
+
+    void reset(double starting_capital);
+    bool on_tick(const Order& order, double mid, double& ret); // false on the first tick (no return yet)
+};
+
+enum class ResampleMethod { BlockBootstrap, TradeShuffle }; // TradeShuffle permutes the returns
+
+struct RobustnessConfig {
+    ResampleMethod method = ResampleMethod::BlockBootstrap;
+    std::size_t resamples = 2000;
+    std::size_t block_length = 10; // Block bootstrap only; preserves short-range autocorrelation
+    unsigned threads = 0;          // 0 uses std::thread::hardware_concurrency()
+    std::uint64_t seed = 42;       // Results depend only on the seed, not on threads
+};
+
+struct PercentileBand {
+    double p5;
+    double p50;
+    double p95;
+};
+
+struct RobustnessReport {
+    PercentileBand sharpe;
+    PercentileBand max_drawdown;
+    PercentileBand total_return;
+    std::size_t resamples;
+};
 
 class PerformanceAnalytics {
 public:
     void calculate_metrics(const std::vector<Trade>& trades);
-    void compare_live_vs_backtest(const std::vector<Trade>& live_trades, const std::vector<Trade>& backtest_trades);
+    void calculate_metrics(const TradeView& trades); // Zero-copy over columnar run results
+    RobustnessReport analyze_robustness(std::span<const double> returns, const RobustnessConfig& config); // Per-tick book returns
+    void compare_live_vs_backtest(const DivergenceTracker& tracker); // O(1): reads the online tracker
     std::map<std::string, double> get_metrics() const;
 
 private:
+    void calculate_price_metrics(std::span<const double> prices);
+
     std::map<std::string, double> metrics_;
 };
\ No newline at end of file
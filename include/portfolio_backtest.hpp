@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+#include "data_manager.hpp"
+#include "strategy_framework.hpp"
+#include "types.hpp" // Include Order and MarketData
+
+// K-way merge of per-asset tick streams into one time-ordered stream, without copying ticks
+class MergedTickStream {
+public:
+    explicit MergedTickStream(std::vector<std::span<const MarketData>> streams);
+    bool next(std::size_t& asset_id, const MarketData*& data); // false when all streams are exhausted
+    std::size_t total_ticks() const { return total_ticks_; }
+
+private:
+    struct Cursor {
+        std::size_t asset_id;
+        std::size_t index;
+    };
+    bool later(const Cursor& a, const Cursor& b) const; // Heap order: timestamp, then asset id
+
+    std::vector<std::span<const MarketData>> streams_;
+    std::vector<Cursor> heap_;
+    std::size_t total_ticks_;
+};
+
+// Dense structure-of-arrays, long-only ledger of positions and marks indexed by asset id
+class PortfolioLedger {
+public:
+    void reset(std::size_t asset_count, double initial_cash);
+    void mark(std::size_t asset_id, double price); // Incremental mark-to-market
+    bool fill(std::size_t asset_id, double quantity, double price); // Signed quantity; false if cash or position is short
+
+    double cash() const { return cash_; }
+    double equity() const { return equity_; }
+    double position(std::size_t asset_id) const { return position_[asset_id]; }
+    double mark_price(std::size_t asset_id) const { return mark_[asset_id]; }
+    std::size_t asset_count() const { return position_.size(); }
+
+private:
+    std::vector<double> position_;
+    std::vector<double> mark_;
+    double cash_ = 0.0;
+    double equity_ = 0.0; // cash_ + sum(position_ * mark_), maintained incrementally
+};
+
+// Strategy with a view of the whole portfolio, for cross-asset logic
+class PortfolioStrategy {
+public:
+    virtual ~PortfolioStrategy() = default;
+    virtual Order on_tick(std::size_t asset_id, const MarketData& data, const PortfolioLedger& ledger) = 0;
+};
+
+// Adapter running one single-asset Strategy per asset id on the shared portfolio
+class PerAssetStrategies : public PortfolioStrategy {
+public:
+    explicit PerAssetStrategies(std::vector<Strategy*> strategies);
+    Order on_tick(std::size_t asset_id, const MarketData& data, const PortfolioLedger& ledger) override;
+
+private:
+    std::vector<Strategy*> strategies_;
+};
+
+class PortfolioBacktest {
+public:
+    PortfolioBacktest(DataManager& data_manager, PortfolioStrategy& strategy);
+    void run(const std::vector<std::string>& assets, double initial_cash);
+    const PortfolioLedger& ledger() const { return ledger_; }
+    const std::vector<double>& equity_curve() const { return equity_curve_; }
+    std::size_t fills() const { return fills_; }
+    std::size_t rejected() const { return rejected_; }
+
+private:
+    DataManager& data_manager_;
+    PortfolioStrategy& strategy_;
+    PortfolioLedger ledger_;
+    std::vector<double> equity_curve_; // Equity after every merged tick
+    std::size_t fills_ = 0;
+    std::size_t rejected_ = 0;
+};
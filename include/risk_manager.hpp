@@ -1,4 +1,5 @@
 #pragma once
+#include <iosfwd>
 #include <vector>
 #include <mutex>
 #include <string>
@@ -9,7 +10,12 @@ public:
     void monitor_realtime_risk(const std::vector<Trade>& trades);
     void calculate_var(const std::vector<Trade>& trades);
     void enforce_risk_limits(const std::vector<Trade>& trades);
+    void on_trade(const Trade& trade); // Incremental update from a single risk thread
+    double get_exposure() const { return exposure_; }
+    void save_state(std::ostream& out) const;
+    bool load_state(std::istream& in);
 
 private:
     std::mutex risk_mutex_;
+    double exposure_ = 0.0;
 };
\ No newline at end of file
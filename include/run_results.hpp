@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "types.hpp" // Include Order and Trade
+
+enum class TradeSide : std::uint8_t { Buy, Sell, Hold };
+
+TradeSide trade_side_from(const std::string& type);
+const char* to_string(TradeSide side);
+
+// Monotonic bump allocator for per-run results; reset() keeps its blocks for the next run
+class RunArena {
+public:
+    explicit RunArena(std::size_t block_bytes = 1 << 20);
+    RunArena(const RunArena&) = delete;
+    RunArena& operator=(const RunArena&) = delete;
+
+    void* allocate(std::size_t bytes, std::size_t alignment);
+    void reset();
+    std::size_t bytes_reserved() const;
+
+    template <typename T>
+    std::span<T> allocate_array(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena memory is never destroyed element-wise");
+        return std::span<T>(static_cast<T*>(allocate(count * sizeof(T), alignof(T))), count);
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+    std::size_t block_bytes_;
+    std::vector<Block> blocks_;
+    std::size_t current_; // Block currently being bumped
+    std::size_t offset_;  // Bytes used in the current block
+};
+
+// Read-only columnar view of one run's trades; valid until the owning arena is reset
+struct TradeView {
+    std::string_view asset;
+    std::span<const double> price;
+    std::span<const double> volume;
+    std::span<const TradeSide> side;
+    std::span<const std::string_view> timestamp;
+
+    std::size_t size() const { return price.size(); }
+    bool empty() const { return price.empty(); }
+    Trade to_trade(std::size_t i) const;
+};
+
+// Columnar trade storage for one run, allocated from a RunArena
+class TradeColumns {
+public:
+    TradeColumns() = default;
+    void begin(RunArena& arena, const std::string& asset, std::size_t capacity); // Starts an empty run
+    void push(const Order& order);
+    TradeView view() const;
+    std::size_t size() const { return count_; }
+
+private:
+    void grow();
+
+    RunArena* arena_ = nullptr;
+    std::string_view asset_;
+    std::span<double> price_;
+    std::span<double> volume_;
+    std::span<TradeSide> side_;
+    std::span<std::string_view> timestamp_;
+    std::size_t count_ = 0;
+};
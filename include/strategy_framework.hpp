@@ -1,21 +1,34 @@
 #pragma once
+#include <iosfwd>
+#include <memory>
 #include <string>
 #include "data_manager.hpp"
+#include "indicator_graph.hpp"
 #include "types.hpp" // Include Order and MarketData
 
 class Strategy {
 public:
     virtual ~Strategy() = default;
     virtual Order execute(const MarketData& data) = 0;
+    virtual void execute(const MarketData& data, Order& order) { order = execute(data); } // Reuses order's storage
+    virtual void save_state(std::ostream&) const {} // Snapshot support for warm restart
+    virtual bool load_state(std::istream&) { return true; }
 };
 
 class MovingAverage : public Strategy {
 public:
     MovingAverage(int short_window, int long_window);
+    MovingAverage(int short_window, int long_window, IndicatorGraph& shared_graph); // Graph advanced by its owner
     Order execute(const MarketData& data) override;
+    void execute(const MarketData& data, Order& order) override;
+    void save_state(std::ostream& out) const override;
+    bool load_state(std::istream& in) override;
 
 private:
     int short_window_;
     int long_window_;
-    std::vector<double> prices_;
+    std::unique_ptr<IndicatorGraph> own_graph_; // Set only when not sharing a graph
+    IndicatorGraph* graph_;
+    IndicatorGraph::NodeId short_node_;
+    IndicatorGraph::NodeId long_node_;
 };
\ No newline at end of file
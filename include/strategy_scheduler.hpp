@@ -0,0 +1,114 @@
+#pragma once
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+#include "types.hpp" // Include MarketData
+
+// Single-threaded cooperative scheduler: each strategy/asset pair runs as a coroutine that
+// awaits its next tick or a timer. Run one scheduler per core to host many strategies.
+class StrategyScheduler {
+public:
+    class Task {
+    public:
+        struct promise_type {
+            Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception();
+        };
+
+        explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+        Task(Task&& other) noexcept : handle_(other.handle_) { other.handle_ = nullptr; }
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        ~Task() { if (handle_) handle_.destroy(); }
+
+    private:
+        friend class StrategyScheduler;
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    class TickAwaiter {
+    public:
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) { scheduler_.tick_waiters_[asset_].push_back(handle); }
+        const MarketData& await_resume() const { return *scheduler_.current_tick_; }
+
+    private:
+        friend class StrategyScheduler;
+        TickAwaiter(StrategyScheduler& scheduler, const std::string& asset) : scheduler_(scheduler), asset_(asset) {}
+        StrategyScheduler& scheduler_;
+        std::string asset_;
+    };
+
+    class TimerAwaiter {
+    public:
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) { scheduler_.timers_.push({deadline_, scheduler_.next_seq_++, handle}); }
+        void await_resume() const noexcept {}
+
+    private:
+        friend class StrategyScheduler;
+        TimerAwaiter(StrategyScheduler& scheduler, const std::string& deadline) : scheduler_(scheduler), deadline_(deadline) {}
+        StrategyScheduler& scheduler_;
+        std::string deadline_;
+    };
+
+    StrategyScheduler() = default;
+    StrategyScheduler(const StrategyScheduler&) = delete;
+    StrategyScheduler& operator=(const StrategyScheduler&) = delete;
+    ~StrategyScheduler();
+
+    TickAwaiter next_tick(const std::string& asset) { return TickAwaiter(*this, asset); }
+    TimerAwaiter wait_until(const std::string& timestamp) { return TimerAwaiter(*this, timestamp); } // Fires on the first tick at or after timestamp
+    void spawn(Task task);
+    void publish(MarketData data);        // Thread-safe; feeds may publish from another thread
+    std::size_t run();                    // Dispatches queued ticks in timestamp order
+    std::size_t task_count() const { return tasks_.size(); }
+
+private:
+    struct QueuedTick {
+        MarketData data;
+        std::uint64_t seq;
+    };
+    struct Timer {
+        std::string deadline;
+        std::uint64_t seq;
+        std::coroutine_handle<> handle;
+    };
+    struct LaterTick {
+        bool operator()(const QueuedTick& a, const QueuedTick& b) const {
+            return a.data.timestamp != b.data.timestamp ? a.data.timestamp > b.data.timestamp : a.seq > b.seq;
+        }
+    };
+    struct LaterTimer {
+        bool operator()(const Timer& a, const Timer& b) const {
+            return a.deadline != b.deadline ? a.deadline > b.deadline : a.seq > b.seq;
+        }
+    };
+
+    void take_published();
+    void fire_timers(const std::string& now);
+
+    std::mutex inbox_mutex_;
+    std::vector<QueuedTick> inbox_;        // Published but not yet merged; guarded by inbox_mutex_
+    std::atomic<bool> inbox_ready_{false}; // Lets run() skip the mutex when nothing was published
+    std::uint64_t publish_seq_ = 0;
+    std::vector<QueuedTick> pending_;      // Min-heap (LaterTick) owned by the run() thread
+    QueuedTick current_;                   // Tick being dispatched, moved out of pending_
+
+    std::vector<std::coroutine_handle<Task::promise_type>> tasks_;
+    std::map<std::string, std::vector<std::coroutine_handle<>>> tick_waiters_;
+    std::vector<std::coroutine_handle<>> resuming_; // Reused buffer to avoid per-tick allocation
+    std::vector<std::coroutine_handle<>> due_;      // Timers collected before any is resumed
+    std::priority_queue<Timer, std::vector<Timer>, LaterTimer> timers_;
+    std::uint64_t next_seq_ = 0;
+    const MarketData* current_tick_ = nullptr;
+};
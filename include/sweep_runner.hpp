@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "data_manager.hpp"
+
+struct SweepConfig {
+    std::vector<std::string> assets;
+    int short_min = 2;
+    int short_max = 20;
+    int long_min = 5;
+    int long_max = 60;
+    std::size_t shard_size = 64; // MovingAverage variants per shard
+    unsigned workers = 4;
+    unsigned max_retries = 2;    // Re-runs of a shard whose worker crashed or timed out
+    int shard_timeout_ms = 120000; // A worker holding a shard longer is killed and the shard retried
+    int handshake_timeout_ms = 10000; // Workers must connect and say Hello within this
+    std::string socket_path;     // Empty picks /tmp/backtester-<pid>.sock
+};
+
+struct SweepResult {
+    std::string asset;
+    int short_window;
+    int long_window;
+    double sharpe;
+    double total_return;
+    std::uint64_t trades;
+};
+
+// Coordinator for a sharded MovingAverage parameter sweep over local worker processes.
+// Workers are forked after data ingestion and share the parsed ticks copy-on-write; all
+// traffic is length-prefixed frames over Unix domain sockets, so a TCP transport can reuse it.
+class SweepCoordinator {
+public:
+    SweepCoordinator(DataManager& data_manager, const SweepConfig& config);
+    std::vector<SweepResult> run(); // Sorted by Sharpe, best first
+    std::size_t failed_shards() const { return failed_shards_; }
+    std::size_t retried_shards() const { return retried_shards_; }
+
+private:
+    DataManager& data_manager_;
+    SweepConfig config_;
+    std::size_t failed_shards_ = 0;
+    std::size_t retried_shards_ = 0;
+};
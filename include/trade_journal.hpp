@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include "types.hpp" // Include Order, Trade and MarketData
+
+enum class JournalKind : std::uint8_t { Order = 1, Fill = 2, Tick = 3 };
+
+// Fixed-size journal entry; seq is written last so a torn append is detected on recovery
+struct JournalRecord {
+    std::uint64_t seq;      // 1-based, contiguous; 0 marks an unwritten slot
+    std::uint32_t checksum;
+    JournalKind kind;
+    std::uint8_t reserved[3];
+    double price;           // Bid for Tick records
+    double volume;
+    double ask;             // Tick records only
+    char asset[16];
+    char type[8];           // "BUY", "SELL" or "HOLD"; empty for Tick records
+    char timestamp[24];
+};
+
+// Append-only, memory-mapped binary journal of input ticks, orders and fills
+class TradeJournal {
+public:
+    TradeJournal();
+    ~TradeJournal();
+    TradeJournal(const TradeJournal&) = delete;
+    TradeJournal& operator=(const TradeJournal&) = delete;
+
+    bool open(const std::string& path, std::size_t initial_capacity = 1 << 16); // Recovers existing records
+    void close();
+    bool append_order(const Order& order);
+    bool append_fill(const Trade& trade);
+    bool append_tick(const MarketData& data);            // Strategy input, replayed on recovery
+    bool reserve(std::size_t appends);                   // Room for appends more records without remapping
+    void flush();                                        // msync for durability beyond a process crash
+    std::span<const JournalRecord> records() const;      // Zero-copy; invalidated when the journal grows
+    std::span<const JournalRecord> records_after(std::uint64_t seq) const;
+    std::uint64_t last_seq() const { return count_; }
+    bool is_open() const { return base_ != nullptr; }
+
+    static Trade to_trade(const JournalRecord& record);
+    static MarketData to_market_data(const JournalRecord& record);
+
+private:
+    bool append(JournalKind kind, const std::string& asset, double price, double volume, double ask,
+                const std::string& type, const std::string& timestamp);
+    bool map(std::size_t capacity);
+    void unmap();
+
+    std::string path_;
+    char* base_;
+    std::size_t capacity_; // Record slots in the current mapping
+    std::uint64_t count_;  // Committed records
+#if defined(_WIN32)
+    void* file_;
+    void* mapping_;
+#else
+    int fd_;
+#endif
+};
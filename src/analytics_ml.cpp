@@ -23,4 +23,18 @@ void MLAnalytics::detect_regime(const std::vector<Trade>& trades) {
     // Log regime detection process for debugging
     // Bug: Placeholder; should analyze trade patterns for regime classification
     std::cout << "Detected regime based on " << trades.size() << " trades\n";
-}
\ No newline at end of file
+}
+
+// Classify the trading strategy from columnar run results
+// trades: Read-only view of a backtest run (e.g., BacktestEngine::trade_view())
+// Note: Placeholder implementation, mirroring the vector overload
+void MLAnalytics::classify_strategy(const TradeView& trades) {
+    std::cout << "Classified strategy based on " << trades.size() << " trades\n";
+}
+
+// Detect market regime from columnar run results
+// trades: Read-only view of a backtest run
+// Note: Placeholder implementation, mirroring the vector overload
+void MLAnalytics::detect_regime(const TradeView& trades) {
+    std::cout << "Detected regime based on " << trades.size() << " trades\n";
+}
@@ -16,8 +16,8 @@ BacktestEngine::BacktestEngine(DataManager& data_manager, Strategy& strategy)
 // asset: Asset pair (e.g., BTC/USD)
 // Why: Simulates trading using the MovingAverage strategy to evaluate performance
 void BacktestEngine::run_backtest(const std::string& asset) {
-    // Retrieve historical data for the asset from DataManager
-    auto historical_data = data_manager_.get_historical_data(asset);
+    // Retrieve a read-only view of the asset's historical data (no copy per run)
+    auto historical_data = data_manager_.historical_view(asset);
     
     // Check if data is available; exit if empty to avoid invalid backtesting
     if (historical_data.empty()) {
@@ -25,34 +25,121 @@ void BacktestEngine::run_backtest(const std::string& asset) {
         return;
     }
     
+    // Start a fresh result buffer; the arena keeps its memory from earlier runs of a sweep
+    // Why: At most one trade per tick, so the columns never grow and no trade is heap-allocated
+    arena_.reset();
+    variant_trades_.clear(); // Their arena memory is reused below
+    trades_.begin(arena_, asset, historical_data.size());
+
+    // Mark a one-unit position book to mid every tick; its returns feed the robustness bootstrap
+    // Why: Starting capital buys one unit at the first mid, as in the sweep's variant scoring
+    book_.reset((historical_data.front().bid + historical_data.front().ask) / 2.0);
+    returns_.clear();
+    returns_.reserve(historical_data.size());
+    
     // Iterate through each historical data point
+    Order order; // Reused every tick so its strings keep their capacity
     for (const auto& data : historical_data) {
         // Execute the strategy (e.g., MovingAverage) to generate an order
         // Why: Converts market data into BUY/SELL/HOLD orders
-        Order order = strategy_.execute(data);
+        strategy_.execute(data, order);
+
+        double ret = 0.0;
+        if (book_.on_tick(order, (data.bid + data.ask) / 2.0, ret)) {
+            returns_.push_back(ret);
+        }
         
-        // Create a trade from the order (ignores HOLD orders implicitly)
-        Trade trade;
-        trade.asset = order.asset;       // Set trade asset (e.g., BTC/USD)
-        trade.price = order.price;       // Set execution price (bid for SELL, ask for BUY)
-        trade.volume = order.volume;     // Set trade volume
-        trade.type = order.type;         // Set trade type (BUY/SELL)
-        trade.timestamp = order.timestamp; // Set trade timestamp
+        // HOLD means no position change, so it is not a trade
+        if (order.type == "HOLD") {
+            continue;
+        }
         
-        // Store the trade in the trades_ vector
-        trades_.push_back(trade);
+        // Store the order as a trade in the columnar result buffer
+        trades_.push(order);
         
         // Log trade execution for debugging and user feedback
-        std::cout << "Executed trade: " << trade.asset << " at " << trade.price << "\n";
+        std::cout << "Executed trade: " << order.asset << " at " << order.price << "\n";
     }
     
     // Log completion of backtest for the MovingAverage strategy
     std::cout << "Backtest completed for strategy: MovingAverage\n";
 }
 
-// Retrieve the list of trades generated during backtesting
-// Returns: Vector of Trade structs
-// Why: Provides trade data for performance analysis (e.g., Sharpe, Sortino)
+// Retrieve the list of trades generated by the last backtest run
+// Returns: Vector of Trade structs (a materialized copy of the columnar results)
+// Why: Kept for callers that need Trade structs; analytics should use trade_view()
 std::vector<Trade> BacktestEngine::get_trades() const {
-    return trades_; // Return the stored trades
-}
\ No newline at end of file
+    TradeView view = trades_.view();
+    std::vector<Trade> trades;
+    trades.reserve(view.size());
+    for (std::size_t i = 0; i < view.size(); ++i) {
+        trades.push_back(view.to_trade(i));
+    }
+    return trades;
+}
+
+// Read-only columnar view of the last backtest run's trades
+// Returns: TradeView over arena memory; invalidated by the next run_backtest/run_variants
+// Why: Lets PerformanceAnalytics and MLAnalytics read results without copying them
+TradeView BacktestEngine::trade_view() const {
+    return trades_.view();
+}
+
+// Run many strategy variants on one asset over a shared indicator graph
+// asset: Asset pair (e.g., BTC/USD)
+// graph: Indicator graph the variants were constructed on (e.g., MovingAverage(s, l, graph))
+// variants: Strategy instances to evaluate; trades and a position book are kept per variant
+// Why: The graph is advanced once per tick, so N variants cost one indicator pass plus N signal checks;
+// each variant's book is marked to mid every tick, so variants are scored on what their signals earn
+void BacktestEngine::run_variants(const std::string& asset, IndicatorGraph& graph, const std::vector<Strategy*>& variants) {
+    auto historical_data = data_manager_.historical_view(asset);
+    if (historical_data.empty()) {
+        std::cerr << "No historical data available for backtest of " << asset << "\n";
+        return;
+    }
+
+    // Variants trade far less often than once per tick, so columns start small and grow in the
+    // arena instead of reserving ticks x variants slots up front
+    constexpr std::size_t initial_capacity = 64;
+    arena_.reset();
+    trades_ = TradeColumns(); // Single-run results shared the arena being reused
+    variant_trades_.resize(variants.size());
+    for (auto& trades : variant_trades_) {
+        trades.begin(arena_, asset, initial_capacity);
+    }
+    // Each variant starts with the capital to hold one unit at the first mid, as in run_backtest
+    variant_books_.resize(variants.size());
+    for (auto& book : variant_books_) {
+        book.reset((historical_data.front().bid + historical_data.front().ask) / 2.0);
+    }
+
+    Order order; // Reused across variants and ticks; push() copies what it keeps
+    for (const auto& data : historical_data) {
+        // Single indicator update shared by every variant for this tick
+        graph.update(data);
+        double mid = (data.bid + data.ask) / 2.0;
+        double ret = 0.0;
+        for (std::size_t i = 0; i < variants.size(); ++i) {
+            variants[i]->execute(data, order);
+            variant_books_[i].on_tick(order, mid, ret);
+            variant_trades_[i].push(order); // Ignores HOLD
+        }
+    }
+
+    std::cout << "Backtest completed for " << variants.size() << " strategy variants on "
+              << graph.node_count() << " shared indicators\n";
+}
+
+// Retrieve trades generated by one variant of the last run_variants call
+// variant: Index into the variants vector passed to run_variants
+// Returns: Read-only columnar view of that variant's trades; valid until the next run
+TradeView BacktestEngine::get_variant_trades(std::size_t variant) const {
+    return variant_trades_.at(variant).view();
+}
+
+// Position book of one variant of the last run_variants call
+// variant: Index into the variants vector passed to run_variants
+// Returns: Book with the variant's per-tick return metrics (acc) and position-change count
+const PositionBook& BacktestEngine::variant_book(std::size_t variant) const {
+    return variant_books_.at(variant);
+}
@@ -194,6 +194,22 @@ std::vector<MarketData> DataManager::get_historical_data(const std::string& asse
     }
 }
 
+// Read-only view of historical data for a specified asset, without copying it
+// asset: Asset pair (e.g., BTC/USD)
+// Returns: Span over stored MarketData (empty if none); invalidated by further ingestion of that asset
+// Why: Lets replay paths such as the portfolio backtest merge many assets without copying each stream
+std::span<const MarketData> DataManager::historical_view(const std::string& asset) const {
+    // Lock mutex for thread-safe lookup; the span itself is read after the lock is released
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    
+    auto it = historical_data_.find(asset);
+    if (it == historical_data_.end()) {
+        std::cerr << "No historical data found for " << asset << "\n";
+        return {};
+    }
+    return it->second;
+}
+
 // Retrieve alternative data for a specified source
 // source: Data source (e.g., "news")
 // Returns: Vector of AlternativeData entries
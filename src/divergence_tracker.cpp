@@ -0,0 +1,135 @@
+// divergence_tracker.cpp: Implementation of DivergenceTracker for live-vs-backtest monitoring
+// Purpose: Compares the live path with a shadow replay of the same strategy on the same ticks,
+// tracking slippage, fill-price delta, signal timing and P&L drift incrementally, and raising
+// threshold alerts on the tick where divergence appears instead of in a post-mortem batch
+
+#include "divergence_tracker.hpp"  // Header file defining DivergenceTracker and thresholds
+#include <cmath>                   // For std::fabs on threshold checks
+#include <iostream>                // For console output (logging alerts)
+#include <utility>                 // For std::move of the alert handler
+
+namespace {
+const char* const kMetricNames[] = {"slippage_bps", "fill_price_delta_bps", "signal_mismatch_ticks", "pnl_drift"};
+}
+
+// Constructor: Initializes an empty tracker with alert thresholds
+// thresholds: Limits for slippage, fill-price delta, signal mismatch run and P&L drift
+DivergenceTracker::DivergenceTracker(const DivergenceThresholds& thresholds)
+    : thresholds_(thresholds) {}
+
+// Install a callback invoked for every alert (in addition to logging)
+// handler: Called on the tick that raised the alert; in deferred mode, by whoever calls raise_deferred()
+void DivergenceTracker::set_alert_handler(std::function<void(const DivergenceAlert&)> handler) {
+    handler_ = std::move(handler);
+}
+
+// Switch between raising alerts inside on_tick() and recording them for the caller
+// deferred: true to record breaches in deferred_alerts() with no logging, handler call or allocation
+// Why: A latency-critical caller (run_low_latency's strategy thread) forwards the records to a
+// thread off the hot path, which raises them with raise_deferred()
+void DivergenceTracker::set_deferred(bool deferred) {
+    deferred_mode_ = deferred;
+    deferred_count_ = 0;
+}
+
+// Update all divergence metrics with one tick of both paths
+// tick: Market data both paths saw
+// live: Order/fill produced by the live path
+// shadow: Order produced by the shadow (simulated) replay of the same strategy
+// Returns: true if any threshold was newly breached on this tick
+// Why: Every metric is a running sum or a single-tick comparison, so the cost per tick is
+// constant and an alert fires on the first tick a metric crosses its threshold
+bool DivergenceTracker::on_tick(const MarketData& tick, const Order& live, const Order& shadow) {
+    ++ticks_;
+    deferred_count_ = 0;
+    double mid = (tick.bid + tick.ask) / 2.0;
+    bool alerted = false;
+
+    // Slippage: live fill against the quote it should have executed at (positive = adverse)
+    double live_qty = signed_quantity(live);
+    if (live_qty != 0.0) {
+        double quote = live_qty > 0.0 ? tick.ask : tick.bid;
+        double direction = live_qty > 0.0 ? 1.0 : -1.0;
+        last_slippage_bps_ = direction * (live.price - quote) / quote * 1e4;
+        slippage_sum_bps_ += last_slippage_bps_;
+        ++live_fills_;
+        alerted |= check(Slippage, last_slippage_bps_, thresholds_.max_slippage_bps, tick);
+    }
+
+    // Signal timing: count consecutive ticks on which the paths disagree on BUY/SELL/HOLD
+    if (live.type != shadow.type) {
+        ++mismatches_;
+        ++mismatch_run_;
+    } else {
+        mismatch_run_ = 0;
+        // Fill-price delta on agreeing fills (positive = live paid more / received less)
+        if (live_qty != 0.0) {
+            double direction = live_qty > 0.0 ? 1.0 : -1.0;
+            double delta_bps = direction * (live.price - shadow.price) / shadow.price * 1e4;
+            price_delta_sum_bps_ += delta_bps;
+            ++matched_fills_;
+            alerted |= check(PriceDelta, delta_bps, thresholds_.max_price_delta_bps, tick);
+        }
+    }
+    alerted |= check(Timing, static_cast<double>(mismatch_run_),
+                     static_cast<double>(thresholds_.max_mismatch_ticks), tick);
+
+    // P&L drift: both books marked to the same mid every tick
+    apply(live_, live, mid);
+    apply(shadow_, shadow, mid);
+    alerted |= check(PnlDrift, std::fabs(pnl_drift()), thresholds_.max_pnl_drift, tick);
+    return alerted;
+}
+
+// Signed order quantity: +volume for BUY, -volume for SELL, 0 otherwise
+double DivergenceTracker::signed_quantity(const Order& order) {
+    if (order.type == "BUY") {
+        return order.volume;
+    }
+    if (order.type == "SELL") {
+        return -order.volume;
+    }
+    return 0.0;
+}
+
+// Apply an order to a book and mark it to the current mid
+void DivergenceTracker::apply(Book& book, const Order& order, double mid) {
+    double quantity = signed_quantity(order);
+    book.cash -= quantity * order.price;
+    book.position += quantity;
+    book.equity = book.cash + book.position * mid;
+}
+
+// Edge-triggered threshold check: alerts once when a metric enters breach, re-arms on recovery
+// Returns: true if an alert was raised (or, in deferred mode, recorded)
+bool DivergenceTracker::check(Metric metric, double value, double threshold, const MarketData& tick) {
+    bool breach = value > threshold;
+    bool raise = breach && !breached_[metric];
+    breached_[metric] = breach;
+    if (!raise) {
+        return false;
+    }
+
+    DeferredAlert alert{static_cast<std::uint8_t>(metric), value, threshold};
+    if (deferred_mode_) {
+        deferred_[deferred_count_++] = alert;
+    } else {
+        raise_deferred(alert, tick.timestamp);
+    }
+    return true;
+}
+
+// Raise an alert recorded by a deferred tracker: log it, call the handler and keep it in alerts()
+// alert: Entry of deferred_alerts()
+// timestamp: Timestamp of the tick that produced it
+// Note: May run on another thread than on_tick(); it touches only the handler and alerts(),
+// which on_tick() does not use in deferred mode
+void DivergenceTracker::raise_deferred(const DeferredAlert& alert, const std::string& timestamp) {
+    DivergenceAlert raised{timestamp, kMetricNames[alert.metric], alert.value, alert.threshold};
+    std::cerr << "Divergence alert at " << raised.timestamp << ": " << raised.metric << "=" << raised.value
+              << " exceeds " << raised.threshold << "\n";
+    if (handler_) {
+        handler_(raised);
+    }
+    alerts_.push_back(std::move(raised));
+}
@@ -0,0 +1,144 @@
+// indicator_graph.cpp: Implementation of IndicatorGraph class for shared indicator computation
+// Purpose: Deduplicates indicator nodes (SMA, EMA) requested by many strategy instances on the
+// same asset stream and computes each node once per tick, so strategy variants share results
+
+#include "indicator_graph.hpp"  // Header file defining IndicatorGraph and IndicatorSpec
+#include <istream>              // For binary snapshot input
+#include <ostream>              // For binary snapshot output
+#include <stdexcept>            // For std::invalid_argument on bad indicator periods
+
+// Constructor: Initializes an empty graph for a single asset stream
+// asset: Asset pair (e.g., BTC/USD) whose ticks drive the graph
+IndicatorGraph::IndicatorGraph(const std::string& asset)
+    : asset_(asset), ticks_(0) {}
+
+// Register an indicator node, or return the existing node for an identical spec
+// spec: Indicator kind and period (e.g., SMA(20))
+// Returns: Node id used to read the indicator value
+// Why: Strategies declare their indicators here so 500 variants of SMA(20) share one node
+IndicatorGraph::NodeId IndicatorGraph::require(const IndicatorSpec& spec) {
+    if (spec.period <= 0) {
+        throw std::invalid_argument("Indicator period must be positive");
+    }
+
+    auto key = std::make_pair(static_cast<int>(spec.kind), spec.period);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        return it->second; // Deduplicated: reuse the existing node
+    }
+
+    Node node;
+    node.kind = spec.kind;
+    node.period = spec.period;
+    node.alpha = 2.0 / (spec.period + 1.0);
+    node.sum = 0.0;
+    node.count = 0;
+
+    // SMA nodes read the outgoing price from the shared window, so it must cover their period
+    if (spec.kind == IndicatorKind::SMA && window_.size() < static_cast<std::size_t>(spec.period)) {
+        grow_window(spec.period);
+    }
+
+    NodeId id = nodes_.size();
+    nodes_.push_back(node);
+    values_.push_back(0.0);
+    index_.emplace(key, id);
+    return id;
+}
+
+// Advance every registered node by one tick
+// data: MarketData for this graph's asset
+// Why: One pass per tick regardless of how many strategies read the results
+void IndicatorGraph::update(const MarketData& data) {
+    double price = (data.bid + data.ask) / 2.0; // Mid-price, as used by MovingAverage
+    std::size_t capacity = window_.size();
+    std::size_t slot = capacity ? static_cast<std::size_t>(ticks_ % capacity) : 0;
+
+    for (std::size_t i = 0; i < nodes_.size(); ++i) {
+        Node& node = nodes_[i];
+        if (node.kind == IndicatorKind::SMA) {
+            node.sum += price;
+            if (node.count >= static_cast<std::uint64_t>(node.period)) {
+                // Drop the price that fell out of the window (read before this tick's write)
+                node.sum -= window_[static_cast<std::size_t>((ticks_ - node.period) % capacity)];
+            }
+            ++node.count;
+            std::uint64_t n = node.count < static_cast<std::uint64_t>(node.period) ? node.count : node.period;
+            values_[i] = node.sum / static_cast<double>(n);
+        } else {
+            // EMA seeded with the first observed price
+            values_[i] = node.count == 0 ? price : values_[i] + node.alpha * (price - values_[i]);
+            ++node.count;
+        }
+    }
+
+    if (capacity) {
+        window_[slot] = price;
+    }
+    ++ticks_;
+}
+
+// Enlarge the shared price window while keeping tick t at slot t % capacity
+// capacity: New window length (longest registered SMA period)
+// Why: Lets strategies register longer SMAs after the stream has already started
+void IndicatorGraph::grow_window(std::size_t capacity) {
+    std::vector<double> grown(capacity, 0.0);
+    std::size_t old_capacity = window_.size();
+    if (old_capacity) {
+        std::uint64_t kept = ticks_ < old_capacity ? ticks_ : old_capacity;
+        for (std::uint64_t t = ticks_ - kept; t < ticks_; ++t) {
+            grown[static_cast<std::size_t>(t % capacity)] = window_[static_cast<std::size_t>(t % old_capacity)];
+        }
+    }
+    window_.swap(grown);
+}
+
+// Write the graph's rolling state as a binary snapshot
+// out: Binary output stream (e.g., a LiveEngine snapshot file)
+// Why: Lets a restarted engine resume indicators without re-ingesting price history
+void IndicatorGraph::save_state(std::ostream& out) const {
+    std::uint64_t node_count = nodes_.size();
+    std::uint64_t window_size = window_.size();
+    out.write(reinterpret_cast<const char*>(&ticks_), sizeof(ticks_));
+    out.write(reinterpret_cast<const char*>(&node_count), sizeof(node_count));
+    out.write(reinterpret_cast<const char*>(&window_size), sizeof(window_size));
+    out.write(reinterpret_cast<const char*>(nodes_.data()), static_cast<std::streamsize>(node_count * sizeof(Node)));
+    out.write(reinterpret_cast<const char*>(values_.data()), static_cast<std::streamsize>(node_count * sizeof(double)));
+    out.write(reinterpret_cast<const char*>(window_.data()), static_cast<std::streamsize>(window_size * sizeof(double)));
+}
+
+// Restore rolling state written by save_state
+// in: Binary input stream positioned at a saved graph
+// Returns: false if the snapshot does not match the registered nodes (state left unchanged)
+bool IndicatorGraph::load_state(std::istream& in) {
+    std::uint64_t ticks = 0;
+    std::uint64_t node_count = 0;
+    std::uint64_t window_size = 0;
+    in.read(reinterpret_cast<char*>(&ticks), sizeof(ticks));
+    in.read(reinterpret_cast<char*>(&node_count), sizeof(node_count));
+    in.read(reinterpret_cast<char*>(&window_size), sizeof(window_size));
+    if (!in || node_count != nodes_.size() || window_size != window_.size()) {
+        return false;
+    }
+
+    std::vector<Node> nodes(nodes_.size());
+    std::vector<double> values(values_.size());
+    std::vector<double> window(window_.size());
+    in.read(reinterpret_cast<char*>(nodes.data()), static_cast<std::streamsize>(node_count * sizeof(Node)));
+    in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(node_count * sizeof(double)));
+    in.read(reinterpret_cast<char*>(window.data()), static_cast<std::streamsize>(window_size * sizeof(double)));
+    if (!in) {
+        return false;
+    }
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i].kind != nodes_[i].kind || nodes[i].period != nodes_[i].period) {
+            return false;
+        }
+    }
+
+    ticks_ = ticks;
+    nodes_.swap(nodes);
+    values_.swap(values);
+    window_.swap(window);
+    return true;
+}
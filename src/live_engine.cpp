@@ -1,8 +1,16 @@
 #include "live_engine.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <thread>
 
 LiveEngine::LiveEngine(DataManager& data_manager, Strategy& strategy)
-    : data_manager_(data_manager), strategy_(strategy), pnl_(0.0) {}
+    : data_manager_(data_manager), strategy_(strategy), pnl_(0.0), journal_(nullptr), shadow_(nullptr), tracker_(nullptr), risk_manager_(nullptr) {}
+
+namespace {
+constexpr std::uint64_t kSnapshotMagic = 0x32504E5342534CULL; // "LSBSNP2": adds shadow strategy state
+}
 
 void LiveEngine::run_live(const std::string& asset) {
     MarketData data;
@@ -11,8 +19,29 @@ void LiveEngine::run_live(const std::string& asset) {
     data.ask = 50010.0;
     data.volume = 1000.0;
     data.timestamp = "2025-07-13 13:00:00";
+    run_live(data);
+}
+
+// Run the live path on one real-time tick
+// data: Tick from the feed; added to the DataManager history and journaled before execution
+// Note: The order is journaled at the strategy's quote; the trade, journaled fill, risk update
+// and divergence tracker all see the fill priced by fill_model_
+void LiveEngine::run_live(const MarketData& data) {
     data_manager_.process_realtime_data(data);
+    if (journal_) {
+        journal_->append_tick(data); // Replayed through the strategies on recovery
+    }
     Order order = strategy_.execute(data);
+    if (journal_) {
+        journal_->append_order(order); // The strategy's intent, at its quote
+    }
+    fill_model_.fill(order); // From here on, order is the live fill
+    if (shadow_) {
+        tracker_->on_tick(data, order, shadow_->execute(data)); // Shadow replay on the same tick
+    }
+    if (order.type == "HOLD") {
+        return; // Not a fill: no trade, journaled fill or risk update
+    }
     Trade trade;
     trade.asset = order.asset;
     trade.price = order.price;
@@ -20,15 +49,353 @@ void LiveEngine::run_live(const std::string& asset) {
     trade.type = order.type;
     trade.timestamp = order.timestamp;
     trades_.push_back(trade);
+    if (journal_) {
+        journal_->append_fill(trade);
+    }
+    if (risk_manager_) {
+        risk_manager_->on_trade(trade);
+    }
     pnl_ = trade.price * trade.volume;
     std::cout << "Shadow trade executed: " << trade.asset << " at " << trade.price << "\n";
     std::cout << "Live P&L: " << pnl_ << "\n";
 }
 
-std::vector<Trade> LiveEngine::get_trades() const {
+// Journal every order and fill produced by this engine
+// journal: Open journal owned by the caller, or nullptr to stop journaling
+void LiveEngine::attach_journal(TradeJournal* journal) {
+    journal_ = journal;
+}
+
+// Run a shadow copy of the strategy in lockstep with the live path
+// shadow: Separate instance with the live strategy's configuration (e.g., MovingAverage(10, 20))
+// tracker: Receives both paths' orders on every tick; both must be set, or shadow nullptr to detach
+// Why: Divergence is measured per tick as it happens rather than by re-scanning trade histories
+void LiveEngine::attach_shadow(Strategy* shadow, DivergenceTracker* tracker) {
+    shadow_ = tracker ? shadow : nullptr;
+    tracker_ = tracker;
+}
+
+// Update incremental risk state with every fill of run_live and hosted strategies
+// risk_manager: Owned by the caller, or nullptr to stop feeding it
+// Why: recover() replays journaled fills into on_trade(), so every live path must feed it too
+// or a restarted engine would count fills an uninterrupted one did not
+// Note: run_low_latency takes its risk manager explicitly and feeds it from the risk thread
+void LiveEngine::attach_risk(RiskManager* risk_manager) {
+    risk_manager_ = risk_manager;
+}
+
+// Write a snapshot of strategy, shadow, risk and P&L state tagged with the journal position
+// path: Snapshot file; written to path + ".tmp" and renamed so a crash never leaves a torn snapshot
+// risk_manager: Risk state to include
+// Returns: true if the snapshot was written
+// Why: Taken periodically by the caller; recovery then only replays journal records after it
+bool LiveEngine::save_snapshot(const std::string& path, const RiskManager& risk_manager) const {
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "Failed to write snapshot at " << tmp_path << "\n";
+            return false;
+        }
+        std::uint64_t seq = journal_ ? journal_->last_seq() : 0;
+        out.write(reinterpret_cast<const char*>(&kSnapshotMagic), sizeof(kSnapshotMagic));
+        out.write(reinterpret_cast<const char*>(&seq), sizeof(seq));
+        out.write(reinterpret_cast<const char*>(&pnl_), sizeof(pnl_));
+        risk_manager.save_state(out);
+        strategy_.save_state(out);
+        // Shadow state too, or a restarted shadow would start cold and report false mismatches
+        std::uint8_t has_shadow = shadow_ ? 1 : 0;
+        out.write(reinterpret_cast<const char*>(&has_shadow), sizeof(has_shadow));
+        if (shadow_) {
+            shadow_->save_state(out);
+        }
+        if (!out) {
+            std::cerr << "Failed to write snapshot at " << tmp_path << "\n";
+            return false;
+        }
+    }
+    if (journal_) {
+        journal_->flush(); // Snapshot must never point past durable journal records
+    }
+    std::error_code error;
+    std::filesystem::rename(tmp_path, path, error);
+    if (error) {
+        std::cerr << "Failed to publish snapshot at " << path << ": " << error.message() << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Restore state after a restart from the last snapshot plus the journal tail
+// snapshot_path: Snapshot written by save_snapshot (a missing file replays the whole journal)
+// risk_manager: Receives restored risk state and every fill after the snapshot
+// Returns: false if the snapshot exists but does not match this strategy configuration
+// Note: Attach the shadow before recovering so it resumes in step with the live strategy
+// Note: trades_ holds only trades executed by this process; the full history stays in the
+// journal and is read zero-copy through TradeJournal::records()
+bool LiveEngine::recover(const std::string& snapshot_path, RiskManager& risk_manager) {
+    std::uint64_t seq = 0;
+    std::ifstream in(snapshot_path, std::ios::binary);
+    if (in.is_open()) {
+        std::uint64_t magic = 0;
+        double pnl = 0.0;
+        in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        in.read(reinterpret_cast<char*>(&seq), sizeof(seq));
+        in.read(reinterpret_cast<char*>(&pnl), sizeof(pnl));
+        std::uint8_t has_shadow = 0;
+        bool compatible = in && magic == kSnapshotMagic && risk_manager.load_state(in) && strategy_.load_state(in) &&
+                          in.read(reinterpret_cast<char*>(&has_shadow), sizeof(has_shadow));
+        // Shadow state is the last section, so a snapshot with one can restore an engine without
+        if (compatible && has_shadow && shadow_) {
+            compatible = shadow_->load_state(in);
+        }
+        if (!compatible) {
+            std::cerr << "Snapshot at " << snapshot_path << " is incompatible; not recovering\n";
+            return false;
+        }
+        if (shadow_ && !has_shadow) {
+            std::cerr << "Snapshot at " << snapshot_path << " has no shadow state; shadow starts cold\n";
+        }
+        pnl_ = pnl;
+    }
+
+    std::size_t replayed = 0;
+    std::size_t replayed_ticks = 0;
+    if (journal_) {
+        // Strategy state is as of the snapshot: ticks after it are re-run through the live and
+        // shadow strategies (their orders are already journaled) and fills re-applied to risk
+        for (const JournalRecord& record : journal_->records_after(seq)) {
+            if (record.kind == JournalKind::Tick) {
+                MarketData data = TradeJournal::to_market_data(record);
+                strategy_.execute(data);
+                if (shadow_) {
+                    shadow_->execute(data);
+                }
+                ++replayed_ticks;
+            } else if (record.kind == JournalKind::Fill) {
+                Trade trade = TradeJournal::to_trade(record);
+                risk_manager.on_trade(trade);
+                pnl_ = trade.price * trade.volume;
+                ++replayed;
+            }
+        }
+    }
+    std::cout << "Recovered live engine from snapshot seq " << seq << " + " << replayed_ticks << " journaled ticks, "
+              << replayed << " fills\n";
+    return true;
+}
+
+const std::vector<Trade>& LiveEngine::get_trades() const {
     return trades_;
 }
 
 double LiveEngine::get_pnl() const {
     return pnl_;
-}
\ No newline at end of file
+}
+
+// Host an additional strategy/asset pair on a coroutine scheduler
+// scheduler: Per-core scheduler that dispatches ticks published by the feed
+// asset: Asset the strategy trades; the coroutine resumes only on this asset's ticks
+// strategy: Strategy instance, owned by the caller and outliving the scheduler
+// Returns: Handle for reading this strategy's own trades and P&L through hosted()
+// Why: Dozens of strategies can share one engine, so results are attributed per strategy
+// instead of being mixed into the engine's trades_/pnl_
+LiveEngine::HostedId LiveEngine::host(StrategyScheduler& scheduler, const std::string& asset, Strategy& strategy) {
+    hosted_.push_back({asset, &strategy, {}, 0.0});
+    scheduler.spawn(strategy_loop(scheduler, hosted_.back()));
+    return hosted_.size() - 1;
+}
+
+// Trades and P&L of one hosted strategy
+// id: Handle returned by host()
+const HostedStrategy& LiveEngine::hosted(HostedId id) const {
+    return hosted_.at(id);
+}
+
+// Coroutine body for a hosted strategy: await tick, execute, record shadow trade, repeat
+// state: Per-strategy record owned by hosted_; receives this strategy's trades and P&L
+StrategyScheduler::Task LiveEngine::strategy_loop(StrategyScheduler& scheduler, HostedStrategy& state) {
+    while (true) {
+        const MarketData& data = co_await scheduler.next_tick(state.asset);
+        Order order = state.strategy->execute(data);
+        if (journal_) {
+            journal_->append_order(order);
+        }
+        fill_model_.fill(order);
+        if (order.type == "HOLD") {
+            continue; // Not a fill: no trade, journaled fill or risk update
+        }
+        state.trades.push_back({order.asset, order.price, order.volume, order.type, order.timestamp});
+        if (journal_) {
+            journal_->append_fill(state.trades.back());
+        }
+        if (risk_manager_) {
+            risk_manager_->on_trade(state.trades.back());
+        }
+        state.pnl = order.price * order.volume;
+    }
+}
+
+
+// Run the live path with pinned feed, strategy and risk threads connected by spin-polled rings
+// asset: Asset whose ticks (from DataManager) are replayed by the feed thread
+// risk_manager: Receives every trade on the risk thread via on_trade()
+// Note: Divergence alerts are recorded on the strategy thread and raised on the risk thread, so
+// an alert handler runs there
+// config: Core assignments, polling mode, memory locking and pre-allocated capacities
+// Why: All storage is reserved and faulted in before the hot loop, so the steady state takes no
+// trade-storage allocation and no page faults; locking is best-effort (a memlock limit only
+// leaves pages swappable) and the report confirms what was applied
+void LiveEngine::run_low_latency(const std::string& asset, RiskManager& risk_manager, const LowLatencyConfig& config) {
+    auto feed = data_manager_.get_historical_data(asset);
+
+    // Warm-up: reserve and touch every buffer the hot loop writes, so it takes no page faults
+    // whether or not the memory lock below succeeds
+    LowLatencyStatus status;
+    trades_.clear();
+    trades_.reserve(config.trade_capacity);
+    trades_.resize(config.trade_capacity); // Faults in the reserved slots; clear() keeps the capacity
+    trades_.clear();
+    Trade* storage = trades_.data();
+    if (journal_ && !journal_->reserve(3 * feed.size())) { // One tick, order and fill per tick at most
+        std::cerr << "Failed to pre-size the trade journal; journaling disabled for this run\n";
+    }
+
+    constexpr std::size_t end_of_feed = static_cast<std::size_t>(-1);
+    // Strategy -> risk thread: a trade, a divergence alert to raise off the hot path, or end of feed
+    struct RiskEvent {
+        const Trade* trade;
+        std::size_t tick;
+        DeferredAlert alert;
+    };
+    SpscRing<std::size_t> tick_ring(config.queue_capacity);
+    SpscRing<RiskEvent> risk_ring(config.queue_capacity);
+    if (shadow_) {
+        tracker_->set_deferred(true); // No logging, handler call or allocation on the strategy thread
+    }
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::size_t recorded = 0;
+    std::size_t dropped = 0;
+
+    auto wait = [&config]() {
+        if (config.busy_poll) {
+            low_latency::cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    };
+    auto warm_up = [&](int core, bool& pinned) {
+        pinned = low_latency::pin_current_thread(core);
+        low_latency::prefault_thread(config.prefault_stack_bytes);
+        ready.fetch_add(1, std::memory_order_release);
+        while (!go.load(std::memory_order_acquire)) {
+            wait();
+        }
+    };
+
+    std::thread feed_thread([&]() {
+        warm_up(config.feed_core, status.feed_pinned);
+        for (std::size_t i = 0; i <= feed.size(); ++i) {
+            std::size_t item = i < feed.size() ? i : end_of_feed;
+            while (!tick_ring.try_push(item)) {
+                wait();
+            }
+        }
+    });
+
+    std::thread strategy_thread([&]() {
+        warm_up(config.strategy_core, status.strategy_pinned);
+        std::size_t index;
+        while (true) {
+            if (!tick_ring.try_pop(index)) {
+                wait();
+                continue;
+            }
+            if (index == end_of_feed) {
+                break;
+            }
+            if (journal_) {
+                journal_->append_tick(feed[index]);
+            }
+            Order order = strategy_.execute(feed[index]);
+            if (journal_) {
+                journal_->append_order(order);
+            }
+            fill_model_.fill(order);
+            if (shadow_ && tracker_->on_tick(feed[index], order, shadow_->execute(feed[index]))) {
+                for (const DeferredAlert& alert : tracker_->deferred_alerts()) {
+                    while (!risk_ring.try_push({nullptr, index, alert})) {
+                        wait();
+                    }
+                }
+            }
+            if (order.type == "HOLD") {
+                continue; // Not a fill: takes no trade slot, journaled fill or risk update
+            }
+            if (trades_.size() == trades_.capacity()) {
+                ++dropped; // Never grow past the pre-allocated capacity on the hot path
+                continue;
+            }
+            trades_.push_back({std::move(order.asset), order.price, order.volume,
+                               std::move(order.type), std::move(order.timestamp)});
+            if (journal_) {
+                journal_->append_fill(trades_.back());
+            }
+            const Trade* trade = storage + recorded++;
+            while (!risk_ring.try_push({trade, index, {}})) {
+                wait();
+            }
+        }
+        while (!risk_ring.try_push({nullptr, end_of_feed, {}})) {
+            wait();
+        }
+    });
+
+    std::thread risk_thread([&]() {
+        warm_up(config.risk_core, status.risk_pinned);
+        RiskEvent event;
+        while (true) {
+            if (!risk_ring.try_pop(event)) {
+                wait();
+                continue;
+            }
+            if (event.trade) {
+                risk_manager.on_trade(*event.trade);
+            } else if (event.tick == end_of_feed) {
+                break;
+            } else {
+                tracker_->raise_deferred(event.alert, feed[event.tick].timestamp);
+            }
+        }
+    });
+
+    // All threads pinned and pre-faulted: lock what is now resident, report, then release them
+    while (ready.load(std::memory_order_acquire) < 3) {
+        std::this_thread::yield();
+    }
+    status.memory_locked = config.lock_memory && low_latency::lock_process_memory();
+    low_latency::report_startup(config, status);
+    long faults_before = low_latency::minor_page_faults();
+    go.store(true, std::memory_order_release);
+
+    feed_thread.join();
+    strategy_thread.join();
+    risk_thread.join();
+    long faults_after = low_latency::minor_page_faults();
+    if (shadow_) {
+        tracker_->set_deferred(false);
+    }
+
+    if (!trades_.empty()) {
+        pnl_ = trades_.back().price * trades_.back().volume;
+    }
+    std::cout << "Low-latency run: " << feed.size() << " ticks, " << recorded << " trades";
+    if (dropped) {
+        std::cout << ", " << dropped << " dropped (trade capacity reached)";
+    }
+    if (faults_before >= 0) {
+        std::cout << ", " << (faults_after - faults_before) << " page faults after warm-up";
+    }
+    std::cout << "\nRisk exposure: " << risk_manager.get_exposure() << "\n";
+}
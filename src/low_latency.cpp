@@ -0,0 +1,149 @@
+// low_latency.cpp: Platform helpers for the low-latency live run mode
+// Purpose: Pins threads to cores, locks and pre-faults memory, and reports the resulting
+// configuration so live deployments can confirm no page faults occur after warm-up
+
+#include "low_latency.hpp"  // Header file defining LowLatencyConfig and SpscRing
+#include <cstdint>          // For SIZE_MAX when the memory lock limit is unbounded
+#include <cstdlib>          // For std::malloc/std::free when warming the thread's allocator
+#include <iostream>         // For console output (startup report)
+#include <string>           // For std::to_string in the report
+#include <thread>           // For std::this_thread::yield fallback
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <malloc.h>
+#else
+#include <alloca.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace low_latency {
+
+// Pin the calling thread to a single CPU core
+// core: Zero-based core index; negative leaves the thread unpinned
+// Returns: true if the affinity was applied
+bool pin_current_thread(int core) {
+    if (core < 0 || core >= core_limit()) {
+        return false;
+    }
+#if defined(_WIN32)
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false; // No affinity API on this platform
+#endif
+}
+
+// Number of core indices pin_current_thread can address
+// Returns: 0 where threads cannot be pinned
+// Why: Shifting the affinity mask or CPU_SET past this bound is undefined behaviour
+int core_limit() {
+#if defined(_WIN32)
+    return static_cast<int>(sizeof(DWORD_PTR) * 8);
+#elif defined(__linux__)
+    return CPU_SETSIZE;
+#else
+    return 0;
+#endif
+}
+
+// Lock the pages currently mapped by the process into RAM
+// Returns: true on success (usually needs CAP_IPC_LOCK or an RLIMIT_MEMLOCK above the process size)
+// Why: Called after every buffer is reserved and pre-faulted, so MCL_FUTURE is not needed; without
+// it a tight memlock limit can never turn a later allocation into std::bad_alloc
+bool lock_process_memory() {
+#if defined(_WIN32)
+    return false; // VirtualLock works per region; not applied process-wide
+#else
+    if (mlockall(MCL_CURRENT) == 0) {
+        return true;
+    }
+    munlockall(); // Do not leave a partially locked address space behind
+    return false;
+#endif
+}
+
+// Current RLIMIT_MEMLOCK soft limit, for the startup report
+// Returns: Limit in bytes, or SIZE_MAX if unlimited or unsupported
+std::size_t memory_lock_limit() {
+#if defined(_WIN32)
+    return SIZE_MAX;
+#else
+    rlimit limit;
+    if (getrlimit(RLIMIT_MEMLOCK, &limit) != 0 || limit.rlim_cur == RLIM_INFINITY) {
+        return SIZE_MAX;
+    }
+    return static_cast<std::size_t>(limit.rlim_cur);
+#endif
+}
+
+// Make the calling thread's stack and allocator state resident before the hot loop
+// stack_bytes: Amount of stack to touch
+// Why: The first allocation on a thread sets up its malloc arena; doing it here keeps those
+// page faults out of the first hot-path Order/Trade construction
+void prefault_thread(std::size_t stack_bytes) {
+    constexpr std::size_t page = 4096;
+    volatile char* probe = static_cast<volatile char*>(alloca(stack_bytes));
+    for (std::size_t i = 0; i < stack_bytes; i += page) {
+        probe[i] = 0;
+    }
+    static thread_local void* volatile arena_probe; // volatile keeps the allocation from being elided
+    arena_probe = std::malloc(page);
+    std::free(arena_probe);
+}
+
+// Number of minor page faults taken by the process so far
+// Returns: Fault count, or -1 where unsupported
+long minor_page_faults() {
+#if defined(_WIN32)
+    return -1;
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+#endif
+}
+
+// Spin-wait hint for busy-poll loops
+void cpu_relax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+// Print the effective low-latency configuration
+// config: Requested configuration
+// status: What was actually applied (pinning and locking can fail without privileges)
+void report_startup(const LowLatencyConfig& config, const LowLatencyStatus& status) {
+    auto pin = [](int core, bool pinned) {
+        return core < 0 ? std::string("unpinned") : "core " + std::to_string(core) + (pinned ? "" : " (FAILED)");
+    };
+    std::string lock = !config.lock_memory ? "off" : status.memory_locked ? "locked" : "FAILED";
+    std::size_t limit = memory_lock_limit();
+    if (config.lock_memory && !status.memory_locked && limit != SIZE_MAX) {
+        lock += " (RLIMIT_MEMLOCK " + std::to_string(limit / 1024) + " KiB; running unlocked)";
+    }
+    std::cout << "Low-latency mode:\n"
+              << "  feed thread:     " << pin(config.feed_core, status.feed_pinned) << "\n"
+              << "  strategy thread: " << pin(config.strategy_core, status.strategy_pinned) << "\n"
+              << "  risk thread:     " << pin(config.risk_core, status.risk_pinned) << "\n"
+              << "  polling:         " << (config.busy_poll ? "busy-poll" : "yield") << "\n"
+              << "  memory lock:     " << lock << "\n"
+              << "  trade capacity:  " << config.trade_capacity << " (pre-allocated)\n"
+              << "  queue capacity:  " << config.queue_capacity << "\n";
+}
+
+} // namespace low_latency
@@ -11,11 +11,93 @@
 #include "order_matching.hpp"      // Matches orders with market data
 #include "market_microstructure.hpp" // Simulates order book and market regimes
 #include "analytics_ml.hpp"        // Applies machine learning for strategy analysis
+#include "sweep_runner.hpp"        // Shards parameter sweeps over local worker processes
+#include "portfolio_backtest.hpp"  // Backtests several assets against one shared ledger
+#include <deque>                   // For per-asset portfolio strategies (stable addresses)
 #include <iostream>                // For console output
+#include <cctype>                  // For std::isdigit when validating --sweep
+#include <charconv>                // For std::from_chars when parsing --cores
+#include <cstdio>                  // For std::sscanf when parsing --sweep
+#include <string>                  // For command-line flag comparison
 #include <thread>                  // For potential multithreading (not used currently)
+#include <vector>                  // For the --portfolio asset list
+
+// Parse --cores=F,S,R into the feed, strategy and risk core assignments
+// value: Text after "--cores="; each index is -1 (unpinned) or below low_latency::core_limit()
+// config: Updated only if all three indices are valid
+// Returns: false for non-numeric, missing, extra or out-of-range indices
+static bool parse_cores(const std::string& value, LowLatencyConfig& config) {
+    int cores[3];
+    const char* next = value.data();
+    const char* end = value.data() + value.size();
+    for (int i = 0; i < 3; ++i) {
+        if (i > 0 && (next == end || *next++ != ',')) {
+            return false;
+        }
+        auto [ptr, error] = std::from_chars(next, end, cores[i]);
+        if (error != std::errc() || cores[i] < -1 || cores[i] >= low_latency::core_limit()) {
+            return false;
+        }
+        next = ptr;
+    }
+    if (next != end) {
+        return false;
+    }
+    config.feed_core = cores[0];
+    config.strategy_core = cores[1];
+    config.risk_core = cores[2];
+    return true;
+}
 
 // Entry point of the trading system
-int main() {
+// Flags: --low-latency         run the live path on pinned, busy-polling threads
+//        --cores=F,S,R         cores for the feed, strategy and risk threads (default unpinned)
+//        --journal=PATH        journal orders/fills to PATH and warm-restart from PATH.snap
+//        --sweep=N             run a sharded MovingAverage parameter sweep on N worker processes
+//        --hosted              also host MovingAverage variants as coroutines on one scheduler
+//        --portfolio=A,B,...   also backtest the listed assets against one shared cash ledger
+int main(int argc, char* argv[]) {
+    // Parse command-line flags for the live run mode
+    bool low_latency_mode = false;
+    LowLatencyConfig low_latency_config;
+    std::string journal_path;
+    unsigned sweep_workers = 0;
+    bool hosted_mode = false;
+    std::vector<std::string> portfolio_assets;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--low-latency") {
+            low_latency_mode = true;
+        } else if (arg.rfind("--cores=", 0) == 0) {
+            if (!parse_cores(arg.substr(8), low_latency_config)) {
+                std::cerr << "Ignoring " << arg << ": expected three core indices in [0, "
+                          << low_latency::core_limit() << ") or -1 for unpinned\n";
+            }
+        } else if (arg == "--hosted") {
+            hosted_mode = true;
+        } else if (arg.rfind("--portfolio=", 0) == 0) {
+            portfolio_assets.clear();
+            std::string list = arg.substr(12) + ",";
+            for (std::size_t begin = 0, comma; (comma = list.find(',', begin)) != std::string::npos; begin = comma + 1) {
+                if (comma == begin) {
+                    std::cerr << "Ignoring " << arg << ": expected a comma-separated asset list\n";
+                    portfolio_assets.clear();
+                    break;
+                }
+                portfolio_assets.push_back(list.substr(begin, comma - begin));
+            }
+        } else if (arg.rfind("--journal=", 0) == 0) {
+            journal_path = arg.substr(10);
+        } else if (arg.rfind("--sweep=", 0) == 0) {
+            char trailing;
+            if (!std::isdigit(static_cast<unsigned char>(arg[8])) ||
+                std::sscanf(arg.c_str() + 8, "%u%c", &sweep_workers, &trailing) != 1) {
+                std::cerr << "Ignoring " << arg << ": expected a worker count\n";
+                sweep_workers = 0;
+            }
+        }
+    }
+
     // Initialize DataManager to handle market and alternative data
     DataManager data_manager;
     
@@ -27,7 +109,16 @@ int main() {
     BacktestEngine backtest_engine(data_manager, strategy);
     
     // Initialize LiveEngine for real-time shadow trading simulation
-    LiveEngine live_engine(data_manager, strategy);
+    // Why: The live path gets its own instance; the backtest's has already seen the historical
+    // ticks, so sharing it would make live and shadow disagree without any real divergence
+    MovingAverage live_strategy(10, 20);
+    LiveEngine live_engine(data_manager, live_strategy);
+    
+    // Replay an identically configured strategy in lockstep with the live path
+    // Why: DivergenceTracker flags live-vs-simulated divergence on the tick it happens
+    MovingAverage shadow_strategy(10, 20);
+    DivergenceTracker divergence_tracker;
+    live_engine.attach_shadow(&shadow_strategy, &divergence_tracker);
     
     // Initialize PerformanceAnalytics to compute metrics (Sharpe, Sortino, MaxDD)
     PerformanceAnalytics performance_analytics;
@@ -58,29 +149,112 @@ int main() {
     // Save ingested data to file for persistence and reuse
     data_manager.save_data("BTC/USD");
 
+    // Optionally shard a MovingAverage parameter sweep over worker processes
+    // Why: Workers are forked after ingestion, so they share the parsed data without re-reading it
+    if (sweep_workers > 0) {
+        SweepConfig sweep_config;
+        sweep_config.assets = {"BTC/USD"};
+        sweep_config.workers = sweep_workers;
+        SweepCoordinator coordinator(data_manager, sweep_config);
+        auto sweep_results = coordinator.run();
+        for (std::size_t i = 0; i < sweep_results.size() && i < 5; ++i) {
+            std::cout << "Sweep #" << (i + 1) << ": MA(" << sweep_results[i].short_window << ", "
+                      << sweep_results[i].long_window << ") Sharpe=" << sweep_results[i].sharpe
+                      << ", Return=" << sweep_results[i].total_return << "\n";
+        }
+    }
+
     // Run backtest on BTC/USDT data using MovingAverage strategy
     // Why: Simulates trading to generate historical trade performance
     backtest_engine.run_backtest("BTC/USD");
+
+    // Optionally backtest several assets at once, each with its own MovingAverage, sharing one
+    // cash balance; ticks of all assets are merged into a single time-ordered stream
+    if (!portfolio_assets.empty()) {
+        std::deque<MovingAverage> portfolio_strategies;
+        std::vector<Strategy*> per_asset;
+        for (const auto& asset : portfolio_assets) {
+            if (data_manager.historical_view(asset).empty()) {
+                data_manager.ingest_historical_data("binance", asset);
+            }
+            per_asset.push_back(&portfolio_strategies.emplace_back(10, 20));
+        }
+        PerAssetStrategies portfolio_strategy(per_asset);
+        PortfolioBacktest portfolio_backtest(data_manager, portfolio_strategy);
+        portfolio_backtest.run(portfolio_assets, 1000000.0);
+        for (std::size_t id = 0; id < portfolio_assets.size(); ++id) {
+            std::cout << "Portfolio position " << portfolio_assets[id] << ": "
+                      << portfolio_backtest.ledger().position(id) << "\n";
+        }
+        std::cout << "Portfolio cash: " << portfolio_backtest.ledger().cash() << "\n";
+    }
     
     // Connect to Binance WebSocket for real-time BTC/USDT data
     // Note: Uses placeholder URL; WebSocket integration in progress due to websocketpp issues
     data_manager.connect_websocket("wss://api.binance.com"); // here add websocket message handling
     
+    // Attach the crash-safe trade journal and resume from the last snapshot plus journal tail
+    // Why: Recovery replays journaled fills into the risk manager, so live fills must feed it too
+    live_engine.attach_risk(&risk_manager);
+    TradeJournal journal;
+    if (!journal_path.empty() && journal.open(journal_path)) {
+        live_engine.attach_journal(&journal);
+        if (!live_engine.recover(journal_path + ".snap", risk_manager)) {
+            // Strategy or risk state may be half-restored; appending to this journal would corrupt it
+            std::cerr << "Cannot resume from " << journal_path << "; aborting\n";
+            return 1;
+        }
+    }
+
     // Simulate live shadow trading for BTC/USDT using MovingAverage strategy
     // Why: Tests strategy in real-time without risking capital
-    live_engine.run_live("BTC/USD"); // Simulate live trading and new comment
+    if (low_latency_mode) {
+        // Replay ticks through pinned feed/strategy/risk threads with pre-allocated storage
+        live_engine.run_low_latency("BTC/USD", risk_manager, low_latency_config);
+    } else {
+        live_engine.run_live("BTC/USD"); // Simulate live trading and new comment
+    }
+    if (journal.is_open()) {
+        live_engine.save_snapshot(journal_path + ".snap", risk_manager);
+    }
 
-    // Retrieve trades from backtesting for performance analysis
-    auto backtest_trades = backtest_engine.get_trades();
+    // Optionally host several strategy variants as coroutines on a single-threaded scheduler
+    // Why: One core replays the feed to every hosted strategy without a thread per strategy
+    if (hosted_mode) {
+        StrategyScheduler scheduler;
+        MovingAverage hosted_variants[] = {MovingAverage(5, 20), MovingAverage(10, 30), MovingAverage(20, 50)};
+        std::vector<LiveEngine::HostedId> hosted_ids;
+        for (auto& variant : hosted_variants) {
+            hosted_ids.push_back(live_engine.host(scheduler, "BTC/USD", variant));
+        }
+        for (const auto& tick : data_manager.historical_view("BTC/USD")) {
+            scheduler.publish(tick);
+        }
+        std::size_t dispatched = scheduler.run();
+        for (auto id : hosted_ids) {
+            const HostedStrategy& hosted = live_engine.hosted(id);
+            std::cout << "Hosted strategy #" << id << " on " << hosted.asset << ": " << hosted.trades.size()
+                      << " trades, P&L=" << hosted.pnl << "\n";
+        }
+        std::cout << "Scheduler dispatched " << dispatched << " ticks to " << scheduler.task_count() << " strategies\n";
+    }
+
+    // Retrieve a read-only columnar view of backtest trades for performance analysis
+    // Why: Consumers read the run's result buffer in place instead of each getting a copy
+    TradeView backtest_trades = backtest_engine.trade_view();
     
-    // Retrieve trades from live trading for comparison
-    auto live_trades = live_engine.get_trades();
+    // Retrieve trades from live trading for comparison (by reference, no copy)
+    const auto& live_trades = live_engine.get_trades();
     
     // Calculate performance metrics (Sharpe, Sortino, MaxDD) for backtest trades
     performance_analytics.calculate_metrics(backtest_trades);
     
-    // Compare live and backtest trade performance to evaluate consistency
-    performance_analytics.compare_live_vs_backtest(live_trades, backtest_trades);
+    // Resample the backtest's per-tick position-book returns to get confidence bands for
+    // Sharpe, MaxDD and return
+    performance_analytics.analyze_robustness(backtest_engine.returns(), RobustnessConfig{});
+    
+    // Compare live and simulated performance using the online divergence tracker
+    performance_analytics.compare_live_vs_backtest(divergence_tracker);
     
     // Monitor real-time P&L for live trades to manage risk
     risk_manager.monitor_realtime_risk(live_trades);
@@ -26,13 +26,23 @@ void OrderMatchingEngine::match_order(const Order& order, const MarketData& mark
 // Apply slippage and latency effects to an order
 // order: Order struct to be modified
 // Why: Simulates realistic trade execution costs and delays for BTC/USDT trades
-// Note: Simplistic implementation with fixed 0.1% slippage
+// Note: Simplistic implementation with fixed 0.1% slippage; see fill()
 void OrderMatchingEngine::apply_slippage_and_latency(Order& order) const {
-    // Apply 0.1% slippage by increasing order price
-    // Why: Simulates market impact and execution delay
-    // Bug: Fixed slippage; should vary based on market conditions (e.g., volume, volatility)
-    order.price *= 1.001; // Simulate 0.1% slippage
-    
+    fill(order);
+
     // Log application of effects for debugging
     std::cout << "Applied slippage and latency to order\n";
-}
\ No newline at end of file
+}
+
+// Fill an order under the slippage model
+// order: Order priced at its quote; BUY pays 0.1% more, SELL receives 0.1% less, HOLD is unchanged
+// Why: The live paths fill every order through this, so it must not log
+// Bug: Fixed slippage; should vary based on market conditions (e.g., volume, volatility)
+void OrderMatchingEngine::fill(Order& order) const {
+    constexpr double slippage = 0.001; // Simulate 0.1% slippage, always against the order
+    if (order.type == "BUY") {
+        order.price *= 1.0 + slippage;
+    } else if (order.type == "SELL") {
+        order.price *= 1.0 - slippage;
+    }
+}
@@ -4,39 +4,61 @@
 
 #include "performance_analytics.hpp"  // Header file defining PerformanceAnalytics class
 #include <iostream>                  // For console output (logging metrics and errors)
-#include <numeric>                   // For std::accumulate to compute mean returns
 #include <cmath>                     // For std::sqrt to calculate standard deviation
+#include <algorithm>                 // For std::nth_element when taking percentiles
+#include <random>                    // For per-thread std::mt19937_64 resampling streams
+#include <thread>                    // For running resamples in parallel
 
 // Calculate performance metrics for a set of trades
 // trades: Vector of Trade structs from backtesting or live trading
 // Why: Evaluates strategy performance using metrics like Sharpe, Sortino, and Maximum Drawdown
 void PerformanceAnalytics::calculate_metrics(const std::vector<Trade>& trades) {
-    // Check if trades vector is empty to avoid invalid calculations
-    if (trades.empty()) {
+    // Gather trade prices; metrics only depend on the price series
+    std::vector<double> prices;
+    prices.reserve(trades.size());
+    for (const auto& trade : trades) {
+        prices.push_back(trade.price);
+    }
+    calculate_price_metrics(prices);
+}
+
+// Calculate performance metrics directly from columnar run results
+// trades: Read-only view of a backtest run (e.g., BacktestEngine::trade_view())
+// Why: Reads the price column in place, so sweeps analyze each run without copying trades
+void PerformanceAnalytics::calculate_metrics(const TradeView& trades) {
+    calculate_price_metrics(trades.price);
+}
+
+// Calculate Sharpe, Sortino and MaxDD from a series of trade prices
+// prices: Execution prices in trade order
+void PerformanceAnalytics::calculate_price_metrics(std::span<const double> prices) {
+    // Check if there are trades to avoid invalid calculations
+    if (prices.empty()) {
         std::cout << "No trades to analyze\n";
         return;
     }
     
     // Calculate returns as percentage change between consecutive trade prices
-    std::vector<double> returns;
-    for (auto it = trades.begin() + 1; it != trades.end(); ++it) {
-        double prev_price = (it - 1)->price;  // Previous trade price
-        double curr_price = it->price;         // Current trade price
+    // Why: Computed on the fly in two passes so no returns vector is allocated
+    std::size_t count = prices.size() - 1;
+    double sum = 0.0;
+    for (std::size_t i = 1; i < prices.size(); ++i) {
         // Compute return as (current - previous) / previous
-        returns.push_back((curr_price - prev_price) / prev_price);
+        sum += (prices[i] - prices[i - 1]) / prices[i - 1];
     }
     
     // Calculate mean return across all trades
     // Why: Used as numerator for Sharpe and Sortino ratios
-    double mean_return = std::accumulate(returns.begin(), returns.end(), 0.0) / returns.size();
+    double mean_return = sum / count;
     
     // Calculate variance of returns
     double variance = 0.0;
-    for (const auto& ret : returns) {
+    for (std::size_t i = 1; i < prices.size(); ++i) {
         // Sum squared differences from mean return
+        double ret = (prices[i] - prices[i - 1]) / prices[i - 1];
         variance += (ret - mean_return) * (ret - mean_return);
     }
-    variance /= returns.size();  // Average to get variance
+    variance /= count;  // Average to get variance
     
     // Calculate standard deviation as square root of variance
     double std_dev = std::sqrt(variance);
@@ -58,14 +80,192 @@ void PerformanceAnalytics::calculate_metrics(const std::vector<Trade>& trades) {
               << ", Sortino=" << metrics_["Sortino"] << ", MaxDD=" << metrics_["MaxDD"] << "\n";
 }
 
-// Compare performance of live trades against backtest trades
-// live_trades: Trades from live shadow trading
-// backtest_trades: Trades from backtesting
-// Why: Evaluates consistency between live and historical performance
-// Note: Placeholder implementation; needs logic to compare metrics
-void PerformanceAnalytics::compare_live_vs_backtest(const std::vector<Trade>& live_trades, const std::vector<Trade>& backtest_trades) {
-    // Log comparison process for debugging
-    std::cout << "Comparing live vs backtest performance...\n";
+// Add one period return to the accumulator
+// ret: Simple return for the period (e.g., 0.01 for +1%)
+// Why: Constant-cost update, so each resample is scored in a single pass without storing it
+void MetricAccumulator::add(double ret) {
+    ++count_;
+    double delta = ret - mean_;
+    mean_ += delta / count_;
+    m2_ += delta * (ret - mean_);
+
+    equity_ *= 1.0 + ret;
+    if (equity_ > peak_) {
+        peak_ = equity_;
+    }
+    double drawdown = (peak_ - equity_) / peak_;
+    if (drawdown > max_drawdown_) {
+        max_drawdown_ = drawdown;
+    }
+}
+
+// Sharpe ratio of the returns added so far (0 for fewer than two returns or zero variance)
+double MetricAccumulator::sharpe() const {
+    if (count_ < 2 || m2_ <= 0.0) {
+        return 0.0;
+    }
+    return mean_ / std::sqrt(m2_ / count_);
+}
+
+// Maximum drawdown of the compounded equity curve, as a fraction of the running peak
+double MetricAccumulator::max_drawdown() const {
+    return max_drawdown_;
+}
+
+// Compounded total return of the returns added so far
+double MetricAccumulator::total_return() const {
+    return equity_ - 1.0;
+}
+
+// Reset the book to a flat position
+// starting_capital: Equity before the first tick
+void PositionBook::reset(double starting_capital) {
+    *this = PositionBook();
+    capital = starting_capital;
+}
+
+// Apply one tick's order and mark the book to mid
+// order: BUY targets a long position of order.volume, SELL a short one, HOLD keeps the position;
+// position changes execute at order.price (the ask or bid)
+// mid: Mid price the book is marked to after the order
+// ret: Receives the equity return since the previous tick
+// Returns: true if ret was set (every tick but the first)
+bool PositionBook::on_tick(const Order& order, double mid, double& ret) {
+    double target = order.type == "BUY" ? order.volume : order.type == "SELL" ? -order.volume : position;
+    if (target != position) {
+        cash -= (target - position) * order.price;
+        position = target;
+        ++trades;
+    }
+    double marked = capital + cash + position * mid;
+    bool has_return = equity > 0.0;
+    if (has_return) {
+        ret = marked / equity - 1.0;
+        acc.add(ret);
+    }
+    equity = marked;
+    return has_return;
+}
+
+// Monte Carlo resampling of a per-tick return series
+// returns: Returns of a position book marked to mid (e.g., BacktestEngine::returns())
+// config: Resampling method, number of resamples, block length, threads and seed
+// Returns: 5th/50th/95th percentile bands for Sharpe, MaxDD and total return (also stored in
+// metrics_ as e.g. Sharpe_p5, MaxDD_p95)
+// Why: Resamples are split across threads, each resample with its own RNG stream seeded from
+// (seed, resample index) so a seed gives the same bands for any thread count, and every
+// resample is scored with a MetricAccumulator in one pass, so thousands of resamples take
+// seconds. Block bootstrap draws circular blocks with replacement; trade
+// shuffle permutes returns (Sharpe and total return are invariant, so it informs MaxDD)
+RobustnessReport PerformanceAnalytics::analyze_robustness(std::span<const double> returns, const RobustnessConfig& config) {
+    RobustnessReport report{{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, 0};
+    if (returns.size() < 2 || config.resamples == 0) {
+        std::cout << "Not enough returns for robustness analysis\n";
+        return report;
+    }
+
+    std::size_t n = returns.size();
+    std::size_t block = config.block_length ? std::min(config.block_length, n) : 1;
+    std::size_t resamples = config.resamples;
+    std::vector<double> sharpe(resamples);
+    std::vector<double> drawdown(resamples);
+    std::vector<double> total(resamples);
+
+    unsigned threads = config.threads ? config.threads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::clamp<std::size_t>(threads ? threads : 1, 1, resamples));
+
+    auto worker = [&](unsigned t) {
+        std::vector<double> scratch(n);
+
+        // Contiguous range per thread keeps result writes off other threads' cache lines
+        std::size_t first = resamples * t / threads;
+        std::size_t last = resamples * (t + 1) / threads;
+        for (std::size_t r = first; r < last; ++r) {
+            // Stream per resample, (seed, resample index), so results do not depend on the thread count
+            std::seed_seq seq{static_cast<std::uint32_t>(config.seed), static_cast<std::uint32_t>(config.seed >> 32),
+                              static_cast<std::uint32_t>(r), static_cast<std::uint32_t>(r >> 32)};
+            std::mt19937_64 rng(seq);
+            std::uniform_int_distribution<std::size_t> start_dist(0, n - 1);
+            MetricAccumulator acc;
+            if (config.method == ResampleMethod::BlockBootstrap) {
+                // Circular blocks of consecutive returns until n returns are drawn
+                for (std::size_t drawn = 0; drawn < n;) {
+                    std::size_t start = start_dist(rng);
+                    for (std::size_t k = 0; k < block && drawn < n; ++k, ++drawn) {
+                        acc.add(returns[(start + k) % n]);
+                    }
+                }
+            } else {
+                std::copy(returns.begin(), returns.end(), scratch.begin()); // Each shuffle starts from tick order
+                std::shuffle(scratch.begin(), scratch.end(), rng);
+                for (double ret : scratch) {
+                    acc.add(ret);
+                }
+            }
+            sharpe[r] = acc.sharpe();
+            drawdown[r] = acc.max_drawdown();
+            total[r] = acc.total_return();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0); // Calling thread takes the first stream
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    auto band = [](std::vector<double>& values) {
+        auto at = [&values](double q) {
+            auto nth = values.begin() + static_cast<std::ptrdiff_t>(q * (values.size() - 1));
+            std::nth_element(values.begin(), nth, values.end());
+            return *nth;
+        };
+        return PercentileBand{at(0.05), at(0.50), at(0.95)};
+    };
+    report.sharpe = band(sharpe);
+    report.max_drawdown = band(drawdown);
+    report.total_return = band(total);
+    report.resamples = resamples;
+
+    metrics_["Sharpe_p5"] = report.sharpe.p5;
+    metrics_["Sharpe_p50"] = report.sharpe.p50;
+    metrics_["Sharpe_p95"] = report.sharpe.p95;
+    metrics_["MaxDD_p5"] = report.max_drawdown.p5;
+    metrics_["MaxDD_p50"] = report.max_drawdown.p50;
+    metrics_["MaxDD_p95"] = report.max_drawdown.p95;
+    metrics_["Return_p5"] = report.total_return.p5;
+    metrics_["Return_p50"] = report.total_return.p50;
+    metrics_["Return_p95"] = report.total_return.p95;
+
+    // Log percentile bands for user feedback
+    std::cout << "Robustness (" << resamples << " resamples, "
+              << (config.method == ResampleMethod::BlockBootstrap ? "block bootstrap" : "trade shuffle")
+              << ", " << threads << " threads): Sharpe [" << report.sharpe.p5 << ", " << report.sharpe.p50
+              << ", " << report.sharpe.p95 << "], MaxDD [" << report.max_drawdown.p5 << ", "
+              << report.max_drawdown.p50 << ", " << report.max_drawdown.p95 << "], Return ["
+              << report.total_return.p5 << ", " << report.total_return.p50 << ", " << report.total_return.p95 << "]\n";
+    return report;
+}
+
+// Record live-vs-shadow divergence from the online tracker
+// tracker: DivergenceTracker updated by LiveEngine on every tick
+// Why: The tracker already holds running totals, so no trade vectors are re-scanned
+void PerformanceAnalytics::compare_live_vs_backtest(const DivergenceTracker& tracker) {
+    metrics_["Divergence_SlippageBps"] = tracker.mean_slippage_bps();
+    metrics_["Divergence_PriceDeltaBps"] = tracker.mean_price_delta_bps();
+    metrics_["Divergence_SignalMismatches"] = static_cast<double>(tracker.signal_mismatches());
+    metrics_["Divergence_PnlDrift"] = tracker.pnl_drift();
+    metrics_["Divergence_Alerts"] = static_cast<double>(tracker.alerts().size());
+    
+    // Log divergence summary for user feedback
+    std::cout << "Live vs shadow over " << tracker.ticks() << " ticks: slippage=" << tracker.mean_slippage_bps()
+              << "bps, fill delta=" << tracker.mean_price_delta_bps() << "bps, signal mismatches="
+              << tracker.signal_mismatches() << ", P&L drift=" << tracker.pnl_drift()
+              << ", alerts=" << tracker.alerts().size() << "\n";
 }
 
 // Retrieve calculated performance metrics
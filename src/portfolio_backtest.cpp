@@ -0,0 +1,152 @@
+// portfolio_backtest.cpp: Implementation of the portfolio-level, event-merged backtest
+// Purpose: Replays many assets' tick streams as one time-ordered event stream against a shared
+// cash and position ledger, so cross-asset strategies can be simulated with shared capital
+
+#include "portfolio_backtest.hpp"  // Header file defining PortfolioBacktest and its helpers
+#include <algorithm>               // For std::push_heap/std::pop_heap on the cursor heap
+#include <iostream>                // For console output (logging run summary and errors)
+#include <utility>                 // For std::move of the stream spans
+
+// Constructor: Builds the cursor heap over per-asset streams
+// streams: One span of ticks per asset id, each already in timestamp order
+// Why: Only one cursor per asset lives in the heap, so nothing is copied or pre-merged
+MergedTickStream::MergedTickStream(std::vector<std::span<const MarketData>> streams)
+    : streams_(std::move(streams)), total_ticks_(0) {
+    heap_.reserve(streams_.size());
+    for (std::size_t id = 0; id < streams_.size(); ++id) {
+        total_ticks_ += streams_[id].size();
+        if (!streams_[id].empty()) {
+            heap_.push_back({id, 0});
+        }
+    }
+    auto compare = [this](const Cursor& a, const Cursor& b) { return later(a, b); };
+    std::make_heap(heap_.begin(), heap_.end(), compare);
+}
+
+// Pop the earliest tick across all streams
+// asset_id: Receives the asset id of the tick
+// data: Receives a pointer into the asset's stream (valid while the source data is unchanged)
+// Returns: false when every stream is exhausted
+bool MergedTickStream::next(std::size_t& asset_id, const MarketData*& data) {
+    if (heap_.empty()) {
+        return false;
+    }
+    auto compare = [this](const Cursor& a, const Cursor& b) { return later(a, b); };
+    std::pop_heap(heap_.begin(), heap_.end(), compare);
+    Cursor& cursor = heap_.back();
+    asset_id = cursor.asset_id;
+    data = &streams_[cursor.asset_id][cursor.index];
+
+    // Advance the cursor and re-insert it, or drop it once its stream is exhausted
+    if (++cursor.index < streams_[cursor.asset_id].size()) {
+        std::push_heap(heap_.begin(), heap_.end(), compare);
+    } else {
+        heap_.pop_back();
+    }
+    return true;
+}
+
+// Heap ordering: a is later than b by timestamp (ISO strings compare lexicographically),
+// with ties broken by asset id so the merge is deterministic
+bool MergedTickStream::later(const Cursor& a, const Cursor& b) const {
+    const std::string& ta = streams_[a.asset_id][a.index].timestamp;
+    const std::string& tb = streams_[b.asset_id][b.index].timestamp;
+    int order = ta.compare(tb);
+    return order != 0 ? order > 0 : a.asset_id > b.asset_id;
+}
+
+// Clear the ledger for a new run
+// asset_count: Number of asset ids in the portfolio
+// initial_cash: Starting capital shared by all assets
+void PortfolioLedger::reset(std::size_t asset_count, double initial_cash) {
+    position_.assign(asset_count, 0.0);
+    mark_.assign(asset_count, 0.0);
+    cash_ = initial_cash;
+    equity_ = initial_cash;
+}
+
+// Update an asset's mark price and the portfolio equity
+// asset_id: Asset whose tick arrived
+// price: New mark (mid) price
+// Why: Only the ticking asset's contribution changes, so equity is updated in O(1)
+void PortfolioLedger::mark(std::size_t asset_id, double price) {
+    equity_ += position_[asset_id] * (price - mark_[asset_id]);
+    mark_[asset_id] = price;
+}
+
+// Apply a fill against the shared cash balance
+// asset_id: Asset traded
+// quantity: Signed quantity (positive buys, negative sells)
+// price: Execution price
+// Returns: false (and leaves the ledger unchanged) if a buy would overdraw cash or a sell
+// exceeds the asset's position
+// Why: The ledger is long-only; an unchecked sell would be a naked short whose proceeds
+// inflate the shared cash and bypass the capital constraint
+bool PortfolioLedger::fill(std::size_t asset_id, double quantity, double price) {
+    double cost = quantity * price;
+    if (cost > cash_ || -quantity > position_[asset_id]) {
+        return false;
+    }
+    cash_ -= cost;
+    position_[asset_id] += quantity;
+    equity_ += quantity * (mark_[asset_id] - price); // Execution away from mark moves equity
+    return true;
+}
+
+// Constructor: Routes asset id i to strategies[i]
+// strategies: One Strategy per asset id, in the same order as the assets passed to run()
+PerAssetStrategies::PerAssetStrategies(std::vector<Strategy*> strategies)
+    : strategies_(std::move(strategies)) {}
+
+// Forward the tick to the asset's own strategy (the ledger is not consulted)
+Order PerAssetStrategies::on_tick(std::size_t asset_id, const MarketData& data, const PortfolioLedger&) {
+    return strategies_.at(asset_id)->execute(data);
+}
+
+// Constructor: Initializes the portfolio backtest with data and a portfolio-level strategy
+PortfolioBacktest::PortfolioBacktest(DataManager& data_manager, PortfolioStrategy& strategy)
+    : data_manager_(data_manager), strategy_(strategy) {}
+
+// Run the portfolio backtest over several assets
+// assets: Asset pairs (e.g., BTC/USD, ETH/USD); the index in this vector is the asset id
+// initial_cash: Starting capital shared by all assets
+// Why: Events are consumed in global time order, so the strategy always sees a consistent
+// portfolio (positions, cash and marks of every asset as of the current tick)
+void PortfolioBacktest::run(const std::vector<std::string>& assets, double initial_cash) {
+    std::vector<std::span<const MarketData>> streams;
+    streams.reserve(assets.size());
+    for (const auto& asset : assets) {
+        streams.push_back(data_manager_.historical_view(asset));
+    }
+    MergedTickStream stream(std::move(streams));
+    if (stream.total_ticks() == 0) {
+        std::cerr << "No historical data available for portfolio backtest\n";
+        return;
+    }
+
+    ledger_.reset(assets.size(), initial_cash);
+    equity_curve_.clear();
+    equity_curve_.reserve(stream.total_ticks());
+    fills_ = 0;
+    rejected_ = 0;
+
+    std::size_t asset_id = 0;
+    const MarketData* data = nullptr;
+    while (stream.next(asset_id, data)) {
+        ledger_.mark(asset_id, (data->bid + data->ask) / 2.0);
+
+        Order order = strategy_.on_tick(asset_id, *data, ledger_);
+        double quantity = order.type == "BUY" ? order.volume : order.type == "SELL" ? -order.volume : 0.0;
+        if (quantity != 0.0) {
+            if (ledger_.fill(asset_id, quantity, order.price)) {
+                ++fills_;
+            } else {
+                ++rejected_; // Insufficient shared cash or nothing to sell
+            }
+        }
+        equity_curve_.push_back(ledger_.equity());
+    }
+
+    std::cout << "Portfolio backtest completed: " << assets.size() << " assets, " << stream.total_ticks()
+              << " ticks, " << fills_ << " fills, " << rejected_ << " rejected, equity=" << ledger_.equity() << "\n";
+}
@@ -4,6 +4,8 @@
 
 #include "risk_manager.hpp"  // Header file defining RiskManager class
 #include <iostream>         // For console output (logging risk metrics and status)
+#include <istream>          // For binary snapshot input
+#include <ostream>          // For binary snapshot output
 
 // Monitor real-time risk by calculating total exposure from trades
 // trades: Vector of Trade structs from backtesting or live trading
@@ -47,4 +49,31 @@ void RiskManager::enforce_risk_limits(const std::vector<Trade>& trades) {
     // Log risk limit enforcement process; actual logic pending
     // Bug: Missing risk limit checks (e.g., stop trading if losses exceed threshold)
     std::cout << "Enforcing risk limits\n";
-}
\ No newline at end of file
+}
+
+// Update running exposure with a single trade
+// trade: Trade just executed on the live path
+// Why: Constant-cost update for the low-latency risk thread; no lock or logging on the hot path
+// Note: Must be called from one thread only; read get_exposure() after that thread has joined
+void RiskManager::on_trade(const Trade& trade) {
+    exposure_ += trade.price * trade.volume;
+}
+
+// Save incremental risk state for a warm restart
+// out: Binary snapshot stream
+void RiskManager::save_state(std::ostream& out) const {
+    out.write(reinterpret_cast<const char*>(&exposure_), sizeof(exposure_));
+}
+
+// Restore incremental risk state written by save_state
+// in: Binary snapshot stream
+// Returns: false if the stream ended early
+bool RiskManager::load_state(std::istream& in) {
+    double exposure = 0.0;
+    in.read(reinterpret_cast<char*>(&exposure), sizeof(exposure));
+    if (!in) {
+        return false;
+    }
+    exposure_ = exposure;
+    return true;
+}
@@ -0,0 +1,142 @@
+// run_results.cpp: Implementation of RunArena and TradeColumns for per-run backtest results
+// Purpose: Stores each run's trades column-wise in a monotonic arena that is reset between
+// runs of a sweep, so results cost no per-trade heap allocation and consumers read them by span
+
+#include "run_results.hpp"  // Header file defining RunArena, TradeColumns and TradeView
+#include <algorithm>        // For std::copy when growing columns
+#include <cstring>          // For std::memcpy when copying strings into the arena
+
+// Map an order type string to its column encoding
+// type: "BUY", "SELL" or anything else (treated as HOLD)
+TradeSide trade_side_from(const std::string& type) {
+    if (type == "BUY") {
+        return TradeSide::Buy;
+    }
+    if (type == "SELL") {
+        return TradeSide::Sell;
+    }
+    return TradeSide::Hold;
+}
+
+// Map a column encoding back to the order type string used by Order/Trade
+const char* to_string(TradeSide side) {
+    switch (side) {
+    case TradeSide::Buy:
+        return "BUY";
+    case TradeSide::Sell:
+        return "SELL";
+    default:
+        return "HOLD";
+    }
+}
+
+// Constructor: Creates an empty arena; blocks are allocated on first use
+// block_bytes: Default block size; larger requests get a dedicated block
+RunArena::RunArena(std::size_t block_bytes)
+    : block_bytes_(block_bytes), current_(0), offset_(0) {}
+
+// Bump-allocate aligned memory from the arena
+// bytes: Allocation size
+// alignment: Required alignment (power of two)
+// Returns: Pointer valid until reset()
+// Why: Reuses blocks kept from previous runs, so a sweep stops allocating after its first run
+void* RunArena::allocate(std::size_t bytes, std::size_t alignment) {
+    while (current_ < blocks_.size()) {
+        Block& block = blocks_[current_];
+        std::size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes <= block.size) {
+            offset_ = aligned + bytes;
+            return block.data.get() + aligned;
+        }
+        ++current_; // Block exhausted (or too small); move on to the next retained block
+        offset_ = 0;
+    }
+
+    std::size_t size = bytes + alignment > block_bytes_ ? bytes + alignment : block_bytes_;
+    blocks_.push_back({std::make_unique<std::byte[]>(size), size});
+    current_ = blocks_.size() - 1;
+    offset_ = 0;
+    return allocate(bytes, alignment);
+}
+
+// Make all arena memory available again without returning it to the system
+// Note: Invalidates every TradeView and TradeColumns built on this arena
+void RunArena::reset() {
+    current_ = 0;
+    offset_ = 0;
+}
+
+// Total bytes held by the arena (high-water mark across runs)
+std::size_t RunArena::bytes_reserved() const {
+    std::size_t total = 0;
+    for (const auto& block : blocks_) {
+        total += block.size;
+    }
+    return total;
+}
+
+// Materialize one row as a Trade (allocates; for callers that need the legacy struct)
+Trade TradeView::to_trade(std::size_t i) const {
+    return {std::string(asset), price[i], volume[i], to_string(side[i]), std::string(timestamp[i])};
+}
+
+// Start an empty run with room for capacity trades
+// arena: Arena the columns are allocated from (typically reset just before)
+// asset: Asset for every trade of this run, stored once rather than per trade
+// capacity: Expected trade count (e.g., number of ticks); columns grow inside the arena if exceeded
+void TradeColumns::begin(RunArena& arena, const std::string& asset, std::size_t capacity) {
+    arena_ = &arena;
+    auto asset_chars = arena.allocate_array<char>(asset.size());
+    std::memcpy(asset_chars.data(), asset.data(), asset.size());
+    asset_ = std::string_view(asset_chars.data(), asset_chars.size());
+
+    capacity = capacity ? capacity : 1;
+    price_ = arena.allocate_array<double>(capacity);
+    volume_ = arena.allocate_array<double>(capacity);
+    side_ = arena.allocate_array<TradeSide>(capacity);
+    timestamp_ = arena.allocate_array<std::string_view>(capacity);
+    count_ = 0;
+}
+
+// Append an order as an executed trade
+// order: Order returned by a strategy; its timestamp characters are copied into the arena
+// Note: HOLD is not a trade and is ignored, so callers can push every order
+void TradeColumns::push(const Order& order) {
+    TradeSide side = trade_side_from(order.type);
+    if (side == TradeSide::Hold) {
+        return;
+    }
+    if (count_ == price_.size()) {
+        grow();
+    }
+    auto chars = arena_->allocate_array<char>(order.timestamp.size());
+    std::memcpy(chars.data(), order.timestamp.data(), order.timestamp.size());
+
+    price_[count_] = order.price;
+    volume_[count_] = order.volume;
+    side_[count_] = side;
+    timestamp_[count_] = std::string_view(chars.data(), chars.size());
+    ++count_;
+}
+
+// Read-only view of the trades pushed so far
+TradeView TradeColumns::view() const {
+    return {asset_, price_.first(count_), volume_.first(count_), side_.first(count_), timestamp_.first(count_)};
+}
+
+// Double every column inside the arena (old columns are simply abandoned until reset)
+void TradeColumns::grow() {
+    std::size_t capacity = price_.size() * 2;
+    auto price = arena_->allocate_array<double>(capacity);
+    auto volume = arena_->allocate_array<double>(capacity);
+    auto side = arena_->allocate_array<TradeSide>(capacity);
+    auto timestamp = arena_->allocate_array<std::string_view>(capacity);
+    std::copy(price_.begin(), price_.begin() + count_, price.begin());
+    std::copy(volume_.begin(), volume_.begin() + count_, volume.begin());
+    std::copy(side_.begin(), side_.begin() + count_, side.begin());
+    std::copy(timestamp_.begin(), timestamp_.begin() + count_, timestamp.begin());
+    price_ = price;
+    volume_ = volume;
+    side_ = side;
+    timestamp_ = timestamp;
+}
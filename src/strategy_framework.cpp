@@ -9,28 +9,75 @@
 // short_window: Number of periods for short moving average (e.g., 10)
 // long_window: Number of periods for long moving average (e.g., 20)
 // Why: Sets up parameters for calculating moving averages to detect price trends
+// Note: Owns a private IndicatorGraph and advances it on every execute() call
 MovingAverage::MovingAverage(int short_window, int long_window)
-    : short_window_(short_window), long_window_(long_window) {}
+    : short_window_(short_window), long_window_(long_window),
+      own_graph_(std::make_unique<IndicatorGraph>("")), graph_(own_graph_.get()) {
+    short_node_ = graph_->require({IndicatorKind::SMA, short_window_});
+    long_node_ = graph_->require({IndicatorKind::SMA, long_window_});
+}
+
+// Constructor: Initializes MovingAverage strategy on a shared indicator graph
+// shared_graph: Per-asset graph advanced once per tick by the engine driving all variants
+// Why: Many parameter variants reuse the same SMA nodes instead of each keeping a price history
+MovingAverage::MovingAverage(int short_window, int long_window, IndicatorGraph& shared_graph)
+    : short_window_(short_window), long_window_(long_window), graph_(&shared_graph) {
+    short_node_ = graph_->require({IndicatorKind::SMA, short_window_});
+    long_node_ = graph_->require({IndicatorKind::SMA, long_window_});
+}
 
 // Execute the MovingAverage strategy on market data to generate a trade order
 // data: MarketData struct containing timestamp, asset, bid, ask, volume
 // Returns: Order struct with asset, price, volume, type (BUY/SELL/HOLD), timestamp
 // Why: Generates trading signals for BTC/USDT based on moving average crossovers
-// Note: Current implementation is a placeholder, always returning BUY; needs crossover logic
 Order MovingAverage::execute(const MarketData& data) {
-    // Calculate mid-price (average of bid and ask) and store in prices_ vector
-    // Why: Mid-price used for moving average calculation (currently not utilized)
-    prices_.push_back((data.bid + data.ask) / 2.0);
-    
-    // Initialize order with default values
     Order order;
+    execute(data, order);
+    return order;
+}
+
+// Execute the strategy into an existing order
+// data: MarketData struct containing timestamp, asset, bid, ask, volume
+// order: Overwritten with the signal; its strings keep their capacity
+// Why: Backtest loops reuse one Order per run, so the per-tick timestamp copy does not allocate
+void MovingAverage::execute(const MarketData& data, Order& order) {
+    // Advance the private graph; a shared graph is advanced by its owner before execute()
+    if (own_graph_) {
+        own_graph_->update(data);
+    }
+
+    // Initialize order with default values
     order.asset = data.asset;       // Set order asset to match input (e.g., BTC/USD)
     order.price = data.ask;        // Set price to ask for BUY orders
     order.volume = 1.0;            // Set fixed volume (1 unit for simplicity)
-    order.type = "BUY";            // Set order type to BUY (placeholder logic)
+    order.type = "HOLD";           // Hold until both moving averages have a full window
     order.timestamp = data.timestamp; // Set order timestamp to match data
-    
-    // Note: Missing moving average crossover logic; should compare short and long MAs
-    // Bug: Always returns BUY order, needs fix to implement MA crossover for BUY/SELL/HOLD
-    return order;
-}
\ No newline at end of file
+
+    // Compare short and long moving averages read from the indicator graph
+    if (graph_->ready(short_node_) && graph_->ready(long_node_)) {
+        double short_ma = graph_->value(short_node_);
+        double long_ma = graph_->value(long_node_);
+        if (short_ma > long_ma) {
+            order.type = "BUY";
+        } else if (short_ma < long_ma) {
+            order.type = "SELL";
+            order.price = data.bid; // Sell orders execute at the bid
+        }
+    }
+}
+
+// Save strategy state for a warm restart
+// out: Binary snapshot stream
+// Note: Only a privately owned graph is saved; a shared graph is snapshotted by its owner
+void MovingAverage::save_state(std::ostream& out) const {
+    if (own_graph_) {
+        own_graph_->save_state(out);
+    }
+}
+
+// Restore strategy state written by save_state
+// in: Binary snapshot stream
+// Returns: false if the snapshot was taken with different window lengths
+bool MovingAverage::load_state(std::istream& in) {
+    return own_graph_ ? own_graph_->load_state(in) : true;
+}
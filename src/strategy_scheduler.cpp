@@ -0,0 +1,107 @@
+// strategy_scheduler.cpp: Implementation of StrategyScheduler for coroutine-based strategy hosting
+// Purpose: Resumes strategy coroutines in tick order on a single thread, so one core can host
+// many strategy/asset pairs without a thread (and context switch) per strategy
+
+#include "strategy_scheduler.hpp"  // Header file defining StrategyScheduler, Task and awaiters
+#include <algorithm>               // For std::push_heap/std::pop_heap on the pending tick heap
+#include <iostream>                // For console output (logging coroutine failures)
+#include <utility>                 // For std::move of published ticks
+
+// Log an exception escaping a strategy coroutine; the coroutine then completes
+// Why: One failing strategy must not take down the other strategies on the same scheduler
+void StrategyScheduler::Task::promise_type::unhandled_exception() {
+    try {
+        throw;
+    } catch (const std::exception& e) {
+        std::cerr << "Strategy coroutine failed: " << e.what() << "\n";
+    } catch (...) {
+        std::cerr << "Strategy coroutine failed with unknown exception\n";
+    }
+}
+
+// Destructor: Destroys all coroutine frames, including those still suspended on a tick or timer
+StrategyScheduler::~StrategyScheduler() {
+    for (auto handle : tasks_) {
+        handle.destroy();
+    }
+}
+
+// Take ownership of a strategy coroutine and run it until its first co_await
+// task: Coroutine returned by a function such as LiveEngine::strategy_loop
+void StrategyScheduler::spawn(Task task) {
+    auto handle = task.handle_;
+    task.handle_ = nullptr; // Scheduler now owns the frame
+    tasks_.push_back(handle);
+    handle.resume();
+}
+
+// Queue a tick for dispatch by run()
+// data: MarketData for any asset hosted by this scheduler; moved in, so feeds can hand over
+// their buffer without a copy
+void StrategyScheduler::publish(MarketData data) {
+    std::lock_guard<std::mutex> lock(inbox_mutex_);
+    inbox_.push_back({std::move(data), publish_seq_++});
+    inbox_ready_.store(true, std::memory_order_release);
+}
+
+// Merge ticks published since the last call into the dispatch heap
+// Why: The mutex is taken only when something was published, not once per dispatched tick
+void StrategyScheduler::take_published() {
+    if (!inbox_ready_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(inbox_mutex_);
+    for (auto& tick : inbox_) {
+        pending_.push_back(std::move(tick));
+        std::push_heap(pending_.begin(), pending_.end(), LaterTick());
+    }
+    inbox_.clear(); // Keeps its capacity for the next batch
+    inbox_ready_.store(false, std::memory_order_relaxed);
+}
+
+// Dispatch all queued ticks in timestamp order (ties in publish order)
+// Returns: Number of ticks dispatched
+// Why: Each tick resumes only the coroutines waiting on that asset, then any due timers; ticks
+// are moved out of the heap, so dispatch copies no MarketData
+std::size_t StrategyScheduler::run() {
+    std::size_t dispatched = 0;
+    while (true) {
+        take_published(); // Ticks published mid-run still merge in timestamp order
+        if (pending_.empty()) {
+            break;
+        }
+        std::pop_heap(pending_.begin(), pending_.end(), LaterTick());
+        current_ = std::move(pending_.back());
+        pending_.pop_back();
+
+        current_tick_ = &current_.data;
+        auto it = tick_waiters_.find(current_.data.asset);
+        if (it != tick_waiters_.end()) {
+            // Swap out the waiters so coroutines re-awaiting this asset register for the next tick
+            resuming_.swap(it->second);
+            for (auto handle : resuming_) {
+                handle.resume();
+            }
+            resuming_.clear();
+        }
+        fire_timers(current_.data.timestamp);
+        current_tick_ = nullptr;
+        ++dispatched;
+    }
+    return dispatched;
+}
+
+// Resume coroutines whose timer deadline is at or before the current tick time
+// now: Timestamp of the tick just dispatched (ISO format compares lexicographically)
+// Why: Due timers are collected before any is resumed, so a coroutine that awaits another
+// deadline <= now fires on the next tick instead of looping here forever
+void StrategyScheduler::fire_timers(const std::string& now) {
+    while (!timers_.empty() && timers_.top().deadline <= now) {
+        due_.push_back(timers_.top().handle);
+        timers_.pop();
+    }
+    for (auto handle : due_) {
+        handle.resume();
+    }
+    due_.clear();
+}
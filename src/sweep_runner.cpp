@@ -0,0 +1,657 @@
+// sweep_runner.cpp: Implementation of SweepCoordinator, a multi-process sharded parameter sweep
+// Purpose: Splits a MovingAverage parameter/asset space into shards, runs them on local worker
+// processes connected over Unix domain sockets, retries shards whose worker crashed, and
+// aggregates results as they stream back - isolating bad configurations from the coordinator
+
+#include "sweep_runner.hpp"        // Header file defining SweepCoordinator, SweepConfig, SweepResult
+#include "backtest_engine.hpp"     // run_variants scores every variant of a shard
+#include "indicator_graph.hpp"     // Shared SMA nodes for all variants of a shard
+#include "performance_analytics.hpp" // PositionBook for per-variant Sharpe and return
+#include "strategy_framework.hpp"  // MovingAverage variants
+#include <algorithm>               // For std::sort of final results
+#include <bit>                     // For std::bit_cast of doubles in frame encoding
+#include <cerrno>                  // For EAGAIN on non-blocking worker sockets
+#include <chrono>                  // For shard and handshake deadlines
+#include <cstring>                 // For std::strncpy of socket paths
+#include <deque>                   // For the pending shard queue
+#include <exception>               // For std::exception from bad shard configurations
+#include <iostream>                // For console output (logging progress and failures)
+#include <map>                     // For live worker processes by pid
+#include <memory>                  // For std::unique_ptr strategy variants
+#include <thread>                  // For std::this_thread::sleep_for while reaping workers
+#include <tuple>                   // For std::tie when ordering tied results
+#include <type_traits>             // For std::make_unsigned_t in frame encoding
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Build with the coordinator disabled on platforms without fork/AF_UNIX support
+#if defined(_WIN32)
+
+SweepCoordinator::SweepCoordinator(DataManager& data_manager, const SweepConfig& config)
+    : data_manager_(data_manager), config_(config) {}
+
+std::vector<SweepResult> SweepCoordinator::run() {
+    std::cerr << "Multi-process sweep is not supported on this platform\n";
+    return {};
+}
+
+#else
+
+namespace {
+
+// Wire protocol: [uint32 payload length][uint16 message type][payload], every field little-endian
+// regardless of host byte order; doubles travel as their IEEE-754 bit pattern
+enum class MessageType : std::uint16_t {
+    Hello = 1,       // worker -> coordinator: protocol version, pid
+    Shard = 2,       // coordinator -> worker: shard id, asset, (short, long) pairs
+    Result = 3,      // worker -> coordinator: shard id, one variant's metrics
+    ShardDone = 4,   // worker -> coordinator: shard id
+    ShardFailed = 5, // worker -> coordinator: shard id, error text (deterministic, not retried)
+    Shutdown = 6     // coordinator -> worker
+};
+
+constexpr std::uint32_t kProtocolVersion = 1; // Bump on any change to frame or payload layout
+constexpr std::uint32_t kMaxFrameBytes = 64u << 20;
+
+struct Shard {
+    std::uint32_t id;
+    std::string asset;
+    std::vector<std::pair<int, int>> params;
+};
+
+// Encode an integer or double as sizeof(T) little-endian bytes
+template <typename T>
+void store_le(char* out, T value) {
+    static_assert(std::is_integral_v<T> || std::is_same_v<T, double>, "Only integers and doubles go on the wire");
+    std::uint64_t bits;
+    if constexpr (std::is_same_v<T, double>) {
+        bits = std::bit_cast<std::uint64_t>(value);
+    } else {
+        bits = static_cast<std::make_unsigned_t<T>>(value);
+    }
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        out[i] = static_cast<char>(bits >> (8 * i));
+    }
+}
+
+// Decode sizeof(T) little-endian bytes written by store_le
+template <typename T>
+T load_le(const char* in) {
+    static_assert(std::is_integral_v<T> || std::is_same_v<T, double>, "Only integers and doubles go on the wire");
+    std::uint64_t bits = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        bits |= static_cast<std::uint64_t>(static_cast<unsigned char>(in[i])) << (8 * i);
+    }
+    if constexpr (std::is_same_v<T, double>) {
+        return std::bit_cast<double>(bits);
+    } else {
+        return static_cast<T>(static_cast<std::make_unsigned_t<T>>(bits));
+    }
+}
+
+class FrameWriter {
+public:
+    template <typename T>
+    void put(T value) {
+        char bytes[sizeof(T)];
+        store_le(bytes, value);
+        buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+    }
+    void put_string(const std::string& value) {
+        put<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+        buffer_.insert(buffer_.end(), value.begin(), value.end());
+    }
+    const std::vector<char>& bytes() const { return buffer_; }
+
+private:
+    std::vector<char> buffer_;
+};
+
+class FrameReader {
+public:
+    explicit FrameReader(const std::vector<char>& payload) : pos_(payload.data()), end_(payload.data() + payload.size()) {}
+    template <typename T>
+    T get() {
+        T value{};
+        if (static_cast<std::size_t>(end_ - pos_) >= sizeof(T)) {
+            value = load_le<T>(pos_);
+            pos_ += sizeof(T);
+        }
+        return value;
+    }
+    std::string get_string() {
+        std::uint32_t length = get<std::uint32_t>();
+        length = std::min<std::uint32_t>(length, static_cast<std::uint32_t>(end_ - pos_));
+        std::string value(pos_, length);
+        pos_ += length;
+        return value;
+    }
+
+private:
+    const char* pos_;
+    const char* end_;
+};
+
+bool write_all(int fd, const char* data, std::size_t size) {
+#if defined(MSG_NOSIGNAL)
+    constexpr int flags = MSG_NOSIGNAL; // A dead peer must not SIGPIPE the coordinator
+#else
+    constexpr int flags = 0;
+#endif
+    while (size > 0) {
+        ssize_t written = send(fd, data, size, flags);
+        if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            // Non-blocking coordinator socket with a full buffer: wait briefly for the worker to drain it
+            pollfd out{fd, POLLOUT, 0};
+            if (poll(&out, 1, 1000) > 0) {
+                continue;
+            }
+            return false;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+bool read_all(int fd, char* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t received = recv(fd, data, size, 0);
+        if (received <= 0) {
+            return false;
+        }
+        data += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+
+bool send_frame(int fd, MessageType type, const FrameWriter& payload) {
+    char header[6];
+    std::uint32_t length = static_cast<std::uint32_t>(payload.bytes().size());
+    store_le(header, length);
+    store_le(header + 4, static_cast<std::uint16_t>(type));
+    return write_all(fd, header, sizeof(header)) && write_all(fd, payload.bytes().data(), length);
+}
+
+enum class FrameStatus { Complete, Partial, Invalid };
+
+// Drain whatever a non-blocking socket has ready into inbox
+// Returns: false once the peer has closed the connection or the socket failed
+bool read_available(int fd, std::vector<char>& inbox) {
+    char buffer[4096];
+    while (true) {
+        ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+        if (received > 0) {
+            inbox.insert(inbox.end(), buffer, buffer + received);
+        } else if (received < 0 && errno == EINTR) {
+            continue;
+        } else {
+            return received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+    }
+}
+
+// Move the first whole frame out of inbox
+// Returns: Partial while the frame is still incomplete, Invalid for an oversized length
+FrameStatus take_frame(std::vector<char>& inbox, MessageType& type, std::vector<char>& payload) {
+    if (inbox.size() < 6) {
+        return FrameStatus::Partial;
+    }
+    std::uint32_t length = load_le<std::uint32_t>(inbox.data());
+    if (length > kMaxFrameBytes) {
+        return FrameStatus::Invalid;
+    }
+    if (inbox.size() - 6 < length) {
+        return FrameStatus::Partial;
+    }
+    type = static_cast<MessageType>(load_le<std::uint16_t>(inbox.data() + 4));
+    payload.assign(inbox.begin() + 6, inbox.begin() + 6 + length);
+    inbox.erase(inbox.begin(), inbox.begin() + 6 + length);
+    return FrameStatus::Complete;
+}
+
+// Blocking receive of one frame (worker side; the coordinator is trusted to send whole frames)
+bool recv_frame(int fd, MessageType& type, std::vector<char>& payload) {
+    char header[6];
+    if (!read_all(fd, header, sizeof(header))) {
+        return false;
+    }
+    std::uint32_t length = load_le<std::uint32_t>(header);
+    if (length > kMaxFrameBytes) {
+        return false;
+    }
+    type = static_cast<MessageType>(load_le<std::uint16_t>(header + 4));
+    payload.resize(length);
+    return read_all(fd, payload.data(), length);
+}
+
+// Run one shard: all its variants share a single indicator pass over the asset's ticks
+void run_shard(DataManager& data_manager, int fd, const Shard& shard) {
+    IndicatorGraph graph(shard.asset);
+    std::vector<std::unique_ptr<MovingAverage>> variants;
+    std::vector<Strategy*> strategies;
+    for (const auto& [short_window, long_window] : shard.params) {
+        variants.push_back(std::make_unique<MovingAverage>(short_window, long_window, graph));
+        strategies.push_back(variants.back().get());
+    }
+    if (variants.empty() || data_manager.historical_view(shard.asset).empty()) {
+        return;
+    }
+
+    // Scored by BacktestEngine's per-variant position books; the engine's own strategy is unused
+    BacktestEngine engine(data_manager, *variants.front());
+    engine.run_variants(shard.asset, graph, strategies);
+
+    // Stream one Result per variant
+    for (std::size_t i = 0; i < variants.size(); ++i) {
+        const PositionBook& book = engine.variant_book(i);
+        FrameWriter result;
+        result.put<std::uint32_t>(shard.id);
+        result.put<std::int32_t>(shard.params[i].first);
+        result.put<std::int32_t>(shard.params[i].second);
+        result.put<double>(book.acc.sharpe());
+        result.put<double>(book.acc.total_return());
+        result.put<std::uint64_t>(book.trades);
+        send_frame(fd, MessageType::Result, result);
+    }
+}
+
+// Worker process body: announce, then run shards until Shutdown or coordinator EOF
+void worker_main(DataManager& data_manager, const std::string& socket_path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        std::cerr << "Sweep worker failed to connect to " << socket_path << "\n";
+        return;
+    }
+
+    FrameWriter hello;
+    hello.put<std::uint32_t>(kProtocolVersion);
+    hello.put<std::int32_t>(static_cast<std::int32_t>(getpid()));
+    send_frame(fd, MessageType::Hello, hello);
+
+    MessageType type;
+    std::vector<char> payload;
+    while (recv_frame(fd, type, payload) && type == MessageType::Shard) {
+        FrameReader reader(payload);
+        Shard shard;
+        shard.id = reader.get<std::uint32_t>();
+        shard.asset = reader.get_string();
+        std::uint32_t count = reader.get<std::uint32_t>();
+        for (std::uint32_t i = 0; i < count; ++i) {
+            int short_window = reader.get<std::int32_t>();
+            int long_window = reader.get<std::int32_t>();
+            shard.params.emplace_back(short_window, long_window);
+        }
+
+        FrameWriter reply;
+        reply.put<std::uint32_t>(shard.id);
+        try {
+            run_shard(data_manager, fd, shard);
+            send_frame(fd, MessageType::ShardDone, reply);
+        } catch (const std::exception& e) {
+            // Bad configuration: report it instead of taking the worker down
+            reply.put_string(e.what());
+            send_frame(fd, MessageType::ShardFailed, reply);
+        }
+    }
+    close(fd);
+}
+
+} // namespace
+
+// Constructor: Captures the data and sweep configuration
+// data_manager: Already-ingested data; forked workers share it copy-on-write, so nothing is re-parsed
+// config: Parameter grid, assets, shard size, worker count and retry policy
+SweepCoordinator::SweepCoordinator(DataManager& data_manager, const SweepConfig& config)
+    : data_manager_(data_manager), config_(config) {}
+
+// Run the sweep to completion
+// Returns: One SweepResult per completed variant, sorted by Sharpe (best first)
+// Why: Shards are handed out on demand, so fast workers take more of them; results are
+// buffered per shard and committed on ShardDone, so a retried shard is never double-counted
+std::vector<SweepResult> SweepCoordinator::run() {
+    // Build shards over the asset x (short, long) grid
+    std::vector<Shard> shards;
+    for (const auto& asset : config_.assets) {
+        Shard shard{0, asset, {}};
+        for (int s = config_.short_min; s <= config_.short_max; ++s) {
+            for (int l = std::max(config_.long_min, s + 1); l <= config_.long_max; ++l) {
+                shard.params.emplace_back(s, l);
+                if (shard.params.size() == config_.shard_size) {
+                    shard.id = static_cast<std::uint32_t>(shards.size());
+                    shards.push_back(shard);
+                    shard.params.clear();
+                }
+            }
+        }
+        if (!shard.params.empty()) {
+            shard.id = static_cast<std::uint32_t>(shards.size());
+            shards.push_back(shard);
+        }
+    }
+    failed_shards_ = 0;
+    retried_shards_ = 0;
+    if (shards.empty()) {
+        std::cerr << "Sweep has no parameter combinations\n";
+        return {};
+    }
+
+    std::string socket_path = config_.socket_path.empty()
+        ? "/tmp/backtester-" + std::to_string(getpid()) + ".sock" : config_.socket_path;
+    unlink(socket_path.c_str());
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    if (listen_fd < 0 || bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(listen_fd, 64) != 0) {
+        std::cerr << "Failed to listen on sweep socket " << socket_path << "\n";
+        if (listen_fd >= 0) {
+            close(listen_fd);
+        }
+        return {};
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto shard_timeout = std::chrono::milliseconds(config_.shard_timeout_ms);
+    auto handshake_timeout = std::chrono::milliseconds(config_.handshake_timeout_ms);
+
+    struct Worker {
+        int fd;
+        pid_t pid;               // 0 until Hello
+        long shard;              // -1 when idle
+        Clock::time_point deadline; // Hello, or the assigned shard, must arrive before this
+        std::vector<char> inbox; // Bytes received but not yet forming a whole frame
+    };
+    std::vector<Worker> workers;
+    std::map<pid_t, Clock::time_point> children; // Live children; Hello deadline, or max once claimed
+    std::deque<std::size_t> pending;
+    for (std::size_t i = 0; i < shards.size(); ++i) {
+        pending.push_back(i);
+    }
+    std::vector<unsigned> attempts(shards.size(), 0);
+    std::vector<std::vector<SweepResult>> partial(shards.size());
+    std::vector<SweepResult> results;
+    std::size_t finished = 0;
+    std::size_t spawned = 0;
+    std::size_t spawn_budget = config_.workers + shards.size() * config_.max_retries;
+
+    auto spawn_worker = [&]() {
+        if (spawned >= spawn_budget) {
+            return;
+        }
+        std::cout.flush(); // Do not duplicate buffered output into the child
+        pid_t pid = fork();
+        if (pid == 0) {
+            close(listen_fd);
+            for (const auto& worker : workers) {
+                close(worker.fd);
+            }
+            worker_main(data_manager_, socket_path);
+            std::cout.flush();
+            _exit(0);
+        }
+        if (pid > 0) {
+            ++spawned;
+            children[pid] = Clock::now() + handshake_timeout;
+        }
+    };
+
+    // Only processes forked here are ever signalled, and only until they are reaped
+    auto kill_child = [&](pid_t pid) {
+        if (children.count(pid)) {
+            kill(pid, SIGKILL);
+        }
+    };
+
+    auto assign = [&](Worker& worker) {
+        if (pending.empty()) {
+            worker.shard = -1;
+            worker.deadline = Clock::time_point::max(); // Idle workers wait for work or Shutdown
+            return;
+        }
+        std::size_t index = pending.front();
+        pending.pop_front();
+        const Shard& shard = shards[index];
+        FrameWriter message;
+        message.put<std::uint32_t>(shard.id);
+        message.put_string(shard.asset);
+        message.put<std::uint32_t>(static_cast<std::uint32_t>(shard.params.size()));
+        for (const auto& [short_window, long_window] : shard.params) {
+            message.put<std::int32_t>(short_window);
+            message.put<std::int32_t>(long_window);
+        }
+        ++attempts[index];
+        worker.shard = static_cast<long>(index);
+        worker.deadline = Clock::now() + shard_timeout;
+        send_frame(worker.fd, MessageType::Shard, message); // A failed send surfaces as EOF below
+    };
+
+    // Requeue (or give up on) the shard of a worker that disconnected without finishing it
+    auto lose_worker = [&](std::size_t slot) {
+        Worker worker = std::move(workers[slot]);
+        close(worker.fd);
+        workers.erase(workers.begin() + static_cast<std::ptrdiff_t>(slot));
+        if (worker.shard >= 0) {
+            std::size_t index = static_cast<std::size_t>(worker.shard);
+            partial[index].clear();
+            if (attempts[index] <= config_.max_retries) {
+                std::cerr << "Sweep worker " << worker.pid << " disconnected; retrying shard " << index << "\n";
+                pending.push_front(index);
+                ++retried_shards_;
+            } else {
+                std::cerr << "Shard " << index << " failed after " << attempts[index] << " attempts\n";
+                ++failed_shards_;
+                ++finished;
+            }
+        }
+    };
+
+    // Apply one complete frame from a worker
+    // Returns: false if the worker was disconnected (its slot is gone)
+    auto handle_frame = [&](std::size_t slot, MessageType type, const std::vector<char>& payload) {
+        Worker& worker = workers[slot];
+        FrameReader reader(payload);
+        if (type == MessageType::Hello) {
+            if (worker.pid != 0) {
+                lose_worker(slot); // Protocol violation: second Hello
+                return false;
+            }
+            std::uint32_t version = reader.get<std::uint32_t>();
+            if (version != kProtocolVersion) {
+                std::cerr << "Sweep worker speaks protocol " << version << ", expected " << kProtocolVersion
+                          << "; disconnecting\n";
+                lose_worker(slot);
+                return false;
+            }
+            // The pid is later used to kill a hung worker, so it must be an unclaimed child of ours
+            pid_t pid = static_cast<pid_t>(reader.get<std::int32_t>());
+            auto child = children.find(pid);
+            if (child == children.end() || child->second == Clock::time_point::max()) {
+                std::cerr << "Sweep worker claims pid " << pid << ", which is not an unclaimed worker; disconnecting\n";
+                lose_worker(slot);
+                return false;
+            }
+            child->second = Clock::time_point::max();
+            worker.pid = pid;
+            assign(worker);
+            return true;
+        }
+
+        // Every other message must name the shard this worker was assigned
+        // Why: shard_id comes off the wire; an unchecked id would index out of bounds, and a
+        // duplicate ShardDone would count a shard twice and end the sweep with work pending
+        std::uint32_t shard_id = reader.get<std::uint32_t>();
+        if (shard_id >= shards.size() || worker.shard != static_cast<long>(shard_id)) {
+            std::cerr << "Sweep worker " << worker.pid << " sent a message for shard " << shard_id
+                      << " it does not own; disconnecting\n";
+            lose_worker(slot);
+            return false;
+        }
+        switch (type) {
+        case MessageType::Result: {
+            SweepResult result;
+            result.asset = shards[shard_id].asset;
+            result.short_window = reader.get<std::int32_t>();
+            result.long_window = reader.get<std::int32_t>();
+            result.sharpe = reader.get<double>();
+            result.total_return = reader.get<double>();
+            result.trades = reader.get<std::uint64_t>();
+            partial[shard_id].push_back(std::move(result));
+            return true;
+        }
+        case MessageType::ShardDone:
+            results.insert(results.end(), partial[shard_id].begin(), partial[shard_id].end());
+            partial[shard_id].clear();
+            ++finished;
+            assign(worker);
+            return true;
+        case MessageType::ShardFailed:
+            std::cerr << "Shard " << shard_id << " rejected: " << reader.get_string() << "\n";
+            partial[shard_id].clear();
+            ++failed_shards_;
+            ++finished;
+            assign(worker);
+            return true;
+        default:
+            lose_worker(slot); // Protocol violation
+            return false;
+        }
+    };
+
+    std::size_t target = std::min<std::size_t>(config_.workers ? config_.workers : 1, shards.size());
+    for (std::size_t i = 0; i < target; ++i) {
+        spawn_worker();
+    }
+
+    while (finished < shards.size()) {
+        // Reap exited children and keep the pool at its target size while work remains
+        int status;
+        pid_t exited;
+        while ((exited = waitpid(-1, &status, WNOHANG)) > 0) {
+            children.erase(exited);
+        }
+        while (children.size() < target && !pending.empty() && spawned < spawn_budget) {
+            spawn_worker();
+        }
+        for (auto& worker : workers) {
+            if (worker.pid != 0 && worker.shard < 0 && !pending.empty()) {
+                assign(worker); // Idle worker picks up a requeued shard
+            }
+        }
+        if (children.empty() && spawned >= spawn_budget) {
+            std::cerr << "Sweep aborted: worker spawn budget exhausted\n";
+            failed_shards_ += shards.size() - finished;
+            break;
+        }
+
+        // Hung or stalled peers: a worker past its shard deadline is killed and its shard retried;
+        // a connection or child that never completed Hello is dropped
+        auto now = Clock::now();
+        for (std::size_t slot = workers.size(); slot-- > 0;) {
+            if (now >= workers[slot].deadline) {
+                std::cerr << "Sweep worker " << workers[slot].pid << " timed out "
+                          << (workers[slot].pid ? "on its shard" : "before Hello") << "\n";
+                if (workers[slot].pid) {
+                    kill_child(workers[slot].pid);
+                }
+                lose_worker(slot);
+            }
+        }
+        for (const auto& [pid, hello_deadline] : children) {
+            if (now >= hello_deadline) {
+                kill(pid, SIGKILL); // Reaped above on a later pass
+            }
+        }
+
+        std::vector<pollfd> fds;
+        fds.push_back({listen_fd, POLLIN, 0});
+        for (const auto& worker : workers) {
+            fds.push_back({worker.fd, POLLIN, 0});
+        }
+        if (poll(fds.data(), fds.size(), 200) <= 0) {
+            continue;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int fd = accept(listen_fd, nullptr, nullptr);
+            if (fd >= 0) {
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK); // A partial frame must never block the loop
+                workers.push_back({fd, 0, -1, Clock::now() + handshake_timeout, {}});
+            }
+        }
+
+        // Walk backwards so lose_worker() can erase without disturbing unvisited slots
+        for (std::size_t slot = fds.size() - 1; slot >= 1; --slot) {
+            if (!(fds[slot].revents & (POLLIN | POLLHUP | POLLERR)) || slot - 1 >= workers.size()) {
+                continue;
+            }
+            bool open = read_available(workers[slot - 1].fd, workers[slot - 1].inbox);
+            MessageType type;
+            std::vector<char> payload;
+            bool alive = true;
+            FrameStatus frame;
+            while (alive && (frame = take_frame(workers[slot - 1].inbox, type, payload)) == FrameStatus::Complete) {
+                alive = handle_frame(slot - 1, type, payload);
+            }
+            if (alive && (!open || frame == FrameStatus::Invalid)) {
+                lose_worker(slot - 1); // EOF (possibly mid-frame) or an oversized frame
+            }
+        }
+    }
+
+    // Release idle workers, then wait for every child; any still running after the grace period
+    // (e.g., hung before Hello) is killed
+    FrameWriter empty;
+    for (const auto& worker : workers) {
+        send_frame(worker.fd, MessageType::Shutdown, empty);
+        close(worker.fd);
+    }
+    auto grace = Clock::now() + handshake_timeout;
+    while (!children.empty()) {
+        int status;
+        pid_t exited = waitpid(-1, &status, WNOHANG);
+        if (exited > 0) {
+            children.erase(exited);
+        } else if (exited < 0) {
+            break;
+        } else if (Clock::now() >= grace) {
+            for (const auto& child : children) {
+                kill(child.first, SIGKILL);
+            }
+            grace = Clock::time_point::max();
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    close(listen_fd);
+    unlink(socket_path.c_str());
+
+    // Ties are ordered by asset and windows so the ranking does not depend on arrival order
+    std::sort(results.begin(), results.end(), [](const SweepResult& a, const SweepResult& b) {
+        if (a.sharpe != b.sharpe) {
+            return a.sharpe > b.sharpe;
+        }
+        return std::tie(a.asset, a.short_window, a.long_window) < std::tie(b.asset, b.short_window, b.long_window);
+    });
+    std::cout << "Sweep completed: " << results.size() << " variants in " << shards.size() << " shards, "
+              << retried_shards_ << " retried, " << failed_shards_ << " failed\n";
+    return results;
+}
+
+#endif
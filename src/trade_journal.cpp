@@ -0,0 +1,348 @@
+// trade_journal.cpp: Implementation of TradeJournal, a crash-safe memory-mapped order/fill log
+// Purpose: Persists every input tick, order and fill of the live engine with a single mapped-memory write,
+// lets analytics read the journal zero-copy, and finds the committed tail quickly after a crash
+
+#include "trade_journal.hpp"  // Header file defining TradeJournal and JournalRecord
+#include <algorithm>          // For std::max when sizing the mapping
+#include <atomic>             // For std::atomic_ref to publish the sequence number last
+#include <cstring>            // For std::memcpy/std::memset on fixed-size record fields
+#include <iostream>           // For console output (logging errors and recovery)
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::uint64_t kJournalMagic = 0x314C4E524A42534CULL; // "LSBJRNL1"
+constexpr std::uint32_t kJournalVersion = 2; // 2: Tick records and the ask field
+
+struct JournalHeader {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t reserved[6];
+};
+static_assert(sizeof(JournalHeader) == 64, "Journal header must stay 64 bytes");
+static_assert(sizeof(JournalRecord) == 88, "Journal record layout is part of the file format");
+
+constexpr std::size_t kHeaderSize = sizeof(JournalHeader);
+
+std::size_t file_bytes(std::size_t capacity) {
+    return kHeaderSize + capacity * sizeof(JournalRecord);
+}
+
+// Word-wise multiplicative hash of a record with its checksum field zeroed
+// Why: Detects records whose bytes did not all reach disk; cheap enough for the append path
+std::uint32_t record_checksum(const JournalRecord& record) {
+    JournalRecord copy = record;
+    copy.checksum = 0;
+    std::uint64_t words[sizeof(JournalRecord) / sizeof(std::uint64_t)];
+    std::memcpy(words, &copy, sizeof(words));
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::uint64_t word : words) {
+        hash = (hash ^ word) * 0x100000001b3ULL;
+    }
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+// Copy a string into a fixed-size, NUL-padded field (truncating if needed)
+template <std::size_t N>
+void copy_field(char (&field)[N], const std::string& value) {
+    std::size_t length = value.size() < N - 1 ? value.size() : N - 1;
+    std::memcpy(field, value.data(), length);
+}
+
+template <std::size_t N>
+std::string read_field(const char (&field)[N]) {
+    std::size_t length = 0;
+    while (length < N && field[length] != '\0') {
+        ++length;
+    }
+    return std::string(field, length);
+}
+
+} // namespace
+
+// Constructor: Creates a closed journal; call open() before appending
+TradeJournal::TradeJournal()
+    : base_(nullptr), capacity_(0), count_(0),
+#if defined(_WIN32)
+      file_(INVALID_HANDLE_VALUE), mapping_(nullptr)
+#else
+      fd_(-1)
+#endif
+{}
+
+// Destructor: Unmaps and closes the journal file (committed records stay in the file)
+TradeJournal::~TradeJournal() {
+    close();
+}
+
+// Open or create a journal file and locate its committed tail
+// path: Journal file path (e.g., data/journal/live.jnl)
+// initial_capacity: Record slots to pre-size a new file with; existing files keep their size
+// Returns: true if the journal is ready for appends
+// Why: Committed records form a contiguous seq prefix, so the tail is found by binary search
+// and only the last record's checksum needs checking - recovery cost is independent of length
+bool TradeJournal::open(const std::string& path, std::size_t initial_capacity) {
+    close();
+    path_ = path;
+    std::size_t existing = 0;
+
+#if defined(_WIN32)
+    file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                        OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        std::cerr << "Failed to open trade journal at " << path << "\n";
+        return false;
+    }
+    LARGE_INTEGER size;
+    GetFileSizeEx(file_, &size);
+    existing = static_cast<std::size_t>(size.QuadPart);
+#else
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        std::cerr << "Failed to open trade journal at " << path << "\n";
+        return false;
+    }
+    struct stat info;
+    fstat(fd_, &info);
+    existing = static_cast<std::size_t>(info.st_size);
+#endif
+
+    bool fresh = existing < kHeaderSize;
+    // At least one slot, or append() could never grow a file cut short inside its first record
+    std::size_t capacity = std::max<std::size_t>(fresh ? initial_capacity : (existing - kHeaderSize) / sizeof(JournalRecord), 1);
+    if (!map(capacity)) {
+        close();
+        return false;
+    }
+
+    auto* header = reinterpret_cast<JournalHeader*>(base_);
+    if (fresh) {
+        std::memset(header, 0, kHeaderSize);
+        header->magic = kJournalMagic;
+        header->version = kJournalVersion;
+        header->record_size = sizeof(JournalRecord);
+    } else if (header->magic != kJournalMagic || header->version != kJournalVersion ||
+               header->record_size != sizeof(JournalRecord)) {
+        std::cerr << "Trade journal at " << path << " has an incompatible format\n";
+        close();
+        return false;
+    }
+
+    // Binary search for the first slot whose seq does not continue the committed prefix
+    const JournalRecord* slots = reinterpret_cast<const JournalRecord*>(base_ + kHeaderSize);
+    std::size_t lo = 0;
+    std::size_t hi = capacity_;
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (slots[mid].seq == mid + 1) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    // Drop a trailing record whose seq landed but whose payload did not
+    while (lo > 0 && record_checksum(slots[lo - 1]) != slots[lo - 1].checksum) {
+        --lo;
+    }
+    count_ = lo;
+
+    if (!fresh) {
+        std::cout << "Recovered trade journal " << path << ": " << count_ << " records\n";
+    }
+    return true;
+}
+
+// Unmap and close the journal file
+void TradeJournal::close() {
+    unmap();
+#if defined(_WIN32)
+    if (file_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(file_);
+        file_ = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+#endif
+    count_ = 0;
+}
+
+// Append an order emitted by a strategy
+bool TradeJournal::append_order(const Order& order) {
+    return append(JournalKind::Order, order.asset, order.price, order.volume, 0.0, order.type, order.timestamp);
+}
+
+// Append a fill (shadow trade) recorded by an engine
+bool TradeJournal::append_fill(const Trade& trade) {
+    return append(JournalKind::Fill, trade.asset, trade.price, trade.volume, 0.0, trade.type, trade.timestamp);
+}
+
+// Append a market data tick before the strategy sees it
+// Why: Strategy state after a snapshot is rebuilt by replaying these ticks; fills alone would
+// restore risk and P&L but leave the strategy's averages as of the snapshot
+bool TradeJournal::append_tick(const MarketData& data) {
+    static const std::string no_type;
+    return append(JournalKind::Tick, data.asset, data.bid, data.volume, data.ask, no_type, data.timestamp);
+}
+
+// Write one record into the mapping
+// Returns: false if the journal is closed or could not grow
+// Why: The payload and checksum are copied first and seq is published last with release
+// ordering, so a reader or a post-crash recovery never sees a partially written record as committed
+bool TradeJournal::append(JournalKind kind, const std::string& asset, double price, double volume, double ask,
+                          const std::string& type, const std::string& timestamp) {
+    if (!base_) {
+        return false;
+    }
+    if (count_ == capacity_ && !map(std::max<std::size_t>(capacity_ * 2, 1))) { // Slow path: double the file
+        return false;
+    }
+
+    JournalRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.seq = count_ + 1;
+    record.kind = kind;
+    record.price = price;
+    record.volume = volume;
+    record.ask = ask;
+    copy_field(record.asset, asset);
+    copy_field(record.type, type);
+    copy_field(record.timestamp, timestamp);
+    record.checksum = record_checksum(record);
+
+    auto* slot = reinterpret_cast<JournalRecord*>(base_ + kHeaderSize) + count_;
+    std::memcpy(reinterpret_cast<char*>(slot) + sizeof(record.seq),
+                reinterpret_cast<const char*>(&record) + sizeof(record.seq),
+                sizeof(record) - sizeof(record.seq));
+    std::atomic_ref<std::uint64_t>(slot->seq).store(record.seq, std::memory_order_release);
+    ++count_;
+    return true;
+}
+
+// Grow the mapping now so the next appends never remap
+// appends: Number of records about to be appended
+// Returns: false if the journal is closed or could not grow
+// Why: Doubling inside append() remaps and faults in the new pages; latency-sensitive callers
+// size the journal during warm-up instead
+bool TradeJournal::reserve(std::size_t appends) {
+    if (!base_) {
+        return false;
+    }
+    std::size_t needed = static_cast<std::size_t>(count_) + appends;
+    if (needed > capacity_ && !map(needed)) {
+        return false;
+    }
+    // MAP_POPULATE maps shared file pages read-only; a write now takes the first-write fault
+    constexpr std::size_t page = 4096;
+    volatile char* begin = base_ + file_bytes(static_cast<std::size_t>(count_));
+    std::size_t bytes = appends * sizeof(JournalRecord);
+    for (std::size_t offset = 0; offset < bytes; offset += page) {
+        begin[offset] = begin[offset];
+    }
+    if (bytes > 0) {
+        begin[bytes - 1] = begin[bytes - 1]; // Range need not start on a page boundary
+    }
+    return true;
+}
+
+// Force mapped pages to stable storage
+// Why: A process crash keeps the page cache; flush() additionally survives power loss
+void TradeJournal::flush() {
+    if (!base_) {
+        return;
+    }
+    std::size_t bytes = file_bytes(static_cast<std::size_t>(count_));
+#if defined(_WIN32)
+    FlushViewOfFile(base_, bytes);
+    FlushFileBuffers(file_);
+#else
+    msync(base_, bytes, MS_SYNC);
+#endif
+}
+
+// All committed records, read directly from the mapping
+std::span<const JournalRecord> TradeJournal::records() const {
+    return records_after(0);
+}
+
+// Committed records with a sequence number greater than seq
+// seq: Last sequence number already applied (e.g., taken from a snapshot)
+std::span<const JournalRecord> TradeJournal::records_after(std::uint64_t seq) const {
+    if (!base_ || seq >= count_) {
+        return {};
+    }
+    const auto* slots = reinterpret_cast<const JournalRecord*>(base_ + kHeaderSize);
+    return std::span<const JournalRecord>(slots + seq, static_cast<std::size_t>(count_ - seq));
+}
+
+// Convert a journal record back into a Trade
+Trade TradeJournal::to_trade(const JournalRecord& record) {
+    return {read_field(record.asset), record.price, record.volume, read_field(record.type), read_field(record.timestamp)};
+}
+
+// Convert a Tick record back into the MarketData the strategy saw
+MarketData TradeJournal::to_market_data(const JournalRecord& record) {
+    return {read_field(record.timestamp), read_field(record.asset), record.price, record.ask, record.volume};
+}
+
+// (Re)map the journal file with room for capacity records, extending the file if needed
+bool TradeJournal::map(std::size_t capacity) {
+    unmap();
+    std::size_t bytes = file_bytes(capacity);
+#if defined(_WIN32)
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE,
+                                  static_cast<DWORD>(static_cast<std::uint64_t>(bytes) >> 32),
+                                  static_cast<DWORD>(bytes & 0xFFFFFFFFu), nullptr);
+    if (!mapping_) {
+        std::cerr << "Failed to map trade journal at " << path_ << "\n";
+        return false;
+    }
+    base_ = static_cast<char*>(MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, bytes));
+#else
+    struct stat info;
+    fstat(fd_, &info);
+    if (static_cast<std::size_t>(info.st_size) < bytes && ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+        std::cerr << "Failed to extend trade journal at " << path_ << "\n";
+        return false;
+    }
+    int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+    flags |= MAP_POPULATE; // Fault the whole mapping in now rather than on the append path
+#endif
+    void* address = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, fd_, 0);
+    base_ = address == MAP_FAILED ? nullptr : static_cast<char*>(address);
+#endif
+    if (!base_) {
+        std::cerr << "Failed to map trade journal at " << path_ << "\n";
+        return false;
+    }
+    capacity_ = capacity;
+    return true;
+}
+
+// Release the current mapping (file stays open)
+void TradeJournal::unmap() {
+    if (!base_) {
+        return;
+    }
+#if defined(_WIN32)
+    UnmapViewOfFile(base_);
+    CloseHandle(mapping_);
+    mapping_ = nullptr;
+#else
+    munmap(base_, file_bytes(capacity_));
+#endif
+    base_ = nullptr;
+    capacity_ = 0;
+}
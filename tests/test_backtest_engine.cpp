@@ -1,3 +1,4 @@
+#undef NDEBUG // Checks use assert and must run in every build type
 #include "backtest_engine.hpp"
 #include "data_manager.hpp"
 #include "strategy_framework.hpp"
@@ -6,19 +7,60 @@
 
 void test_backtest_engine() {
     DataManager data_manager;
-    BacktestEngine engine(data_manager);
-    Strategy strategy("TestStrategy", "BTC/USD");
-    BacktestConfig config{"2025-01-01", "2025-07-12", 100000.0, "S&P500"};
+    MovingAverage strategy(1, 2);
+    BacktestEngine engine(data_manager, strategy);
 
     data_manager.ingest_historical_data("binance", "BTC/USD");
-    engine.run_backtest(strategy, config);
+    engine.run_backtest("BTC/USD");
 
-    auto metrics = engine.get_performance_metrics();
-    assert(metrics.find("sharpe_ratio") != metrics.end());
+    // First tick holds (not recorded) until the long average is ready; then the rising tick
+    // buys at the ask and the falling tick sells at the bid
+    TradeView trades = engine.trade_view();
+    assert(trades.size() == 2);
+    assert(trades.side[0] == TradeSide::Buy && trades.price[0] == 50015.0);
+    assert(trades.side[1] == TradeSide::Sell && trades.price[1] == 49995.0);
+    assert(engine.get_trades().back().type == "SELL");
+
+    // The position book is marked every tick, HOLD included: one return per tick after the first
+    assert(engine.returns().size() == 2);
+    assert(engine.book().trades == 2 && engine.book().position == -1.0);
     std::cout << "Backtest engine test passed\n";
 }
 
+void test_run_variants_scores_each_variant() {
+    DataManager data_manager;
+    double bid = 50000.0;
+    for (int i = 0; i < 120; ++i) {
+        bid += (i / 10) % 2 ? -35.0 : 40.0; // Alternating 10-tick trends
+        data_manager.process_realtime_data({"2025-07-12 13:00:00", "BTC/USD", bid, bid + 10.0, 1.0});
+    }
+    IndicatorGraph graph("BTC/USD");
+    MovingAverage fast(2, 5, graph);
+    MovingAverage slow(4, 12, graph);
+    BacktestEngine engine(data_manager, fast);
+    engine.run_variants("BTC/USD", graph, {&fast, &slow});
+
+    // Each shared-graph variant scores exactly like a standalone strategy on its own book
+    const std::pair<int, int> windows[] = {{2, 5}, {4, 12}};
+    auto ticks = data_manager.historical_view("BTC/USD");
+    for (std::size_t v = 0; v < 2; ++v) {
+        MovingAverage standalone(windows[v].first, windows[v].second);
+        PositionBook expected;
+        expected.reset((ticks.front().bid + ticks.front().ask) / 2.0);
+        double ret = 0.0;
+        for (const auto& tick : ticks) {
+            expected.on_tick(standalone.execute(tick), (tick.bid + tick.ask) / 2.0, ret);
+        }
+        const PositionBook& book = engine.variant_book(v);
+        assert(book.trades == expected.trades && book.trades > 0);
+        assert(book.acc.sharpe() == expected.acc.sharpe());
+        assert(book.acc.total_return() == expected.acc.total_return());
+    }
+    std::cout << "Variant scoring test passed\n";
+}
+
 int main() {
     test_backtest_engine();
+    test_run_variants_scores_each_variant();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,146 @@
+#undef NDEBUG // Checks use assert and must run in every build type
+#include "indicator_graph.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+// Deterministic, non-monotonic mid prices; ask - bid is constant so mid == bid + 5
+std::vector<MarketData> make_ticks(std::size_t count) {
+    std::vector<MarketData> ticks;
+    std::uint32_t state = 12345;
+    double price = 50000.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        state = state * 1664525u + 1013904223u;
+        price += static_cast<double>(state >> 24) - 127.5;
+        ticks.push_back({"2025-07-12 13:00:00", "BTC/USD", price, price + 10.0, 1000.0});
+    }
+    return ticks;
+}
+
+double mid(const MarketData& tick) {
+    return (tick.bid + tick.ask) / 2.0;
+}
+
+// Naive SMA of the last min(period, available) mids in ticks[first, last]
+double naive_sma(const std::vector<MarketData>& ticks, std::size_t first, std::size_t last, int period) {
+    std::size_t begin = last + 1 - first > static_cast<std::size_t>(period) ? last + 1 - period : first;
+    double sum = 0.0;
+    for (std::size_t i = begin; i <= last; ++i) {
+        sum += mid(ticks[i]);
+    }
+    return sum / static_cast<double>(last + 1 - begin);
+}
+
+bool close(double a, double b) {
+    return std::fabs(a - b) <= 1e-9 * std::fabs(b);
+}
+
+} // namespace
+
+void test_duplicate_specs_share_nodes() {
+    IndicatorGraph graph("BTC/USD");
+    auto a = graph.require({IndicatorKind::SMA, 20});
+    auto b = graph.require({IndicatorKind::SMA, 20});
+    auto c = graph.require({IndicatorKind::EMA, 20});
+    assert(a == b && a != c);
+    assert(graph.node_count() == 2);
+    std::cout << "Indicator dedup test passed\n";
+}
+
+void test_sma_matches_naive() {
+    auto ticks = make_ticks(500);
+    IndicatorGraph graph("BTC/USD");
+    const int periods[] = {1, 2, 7, 20, 64};
+    std::vector<IndicatorGraph::NodeId> nodes;
+    for (int period : periods) {
+        nodes.push_back(graph.require({IndicatorKind::SMA, period}));
+    }
+    for (std::size_t t = 0; t < ticks.size(); ++t) {
+        graph.update(ticks[t]);
+        for (std::size_t k = 0; k < nodes.size(); ++k) {
+            assert(graph.ready(nodes[k]) == (t + 1 >= static_cast<std::size_t>(periods[k])));
+            assert(close(graph.value(nodes[k]), naive_sma(ticks, 0, t, periods[k])));
+        }
+    }
+    std::cout << "Indicator SMA test passed\n";
+}
+
+void test_longer_sma_registered_mid_stream() {
+    auto ticks = make_ticks(300);
+    IndicatorGraph graph("BTC/USD");
+    auto short_node = graph.require({IndicatorKind::SMA, 5});
+    std::size_t registered_at = 37; // Not a multiple of either window length
+    IndicatorGraph::NodeId long_node = 0;
+    for (std::size_t t = 0; t < ticks.size(); ++t) {
+        if (t == registered_at) {
+            long_node = graph.require({IndicatorKind::SMA, 50}); // Grows the shared window
+        }
+        graph.update(ticks[t]);
+        assert(close(graph.value(short_node), naive_sma(ticks, 0, t, 5)));
+        if (t >= registered_at) {
+            // The new node averages only ticks it has seen since registration
+            assert(close(graph.value(long_node), naive_sma(ticks, registered_at, t, 50)));
+        }
+    }
+    std::cout << "Indicator mid-stream registration test passed\n";
+}
+
+void test_ema_matches_naive() {
+    auto ticks = make_ticks(200);
+    IndicatorGraph graph("BTC/USD");
+    auto node = graph.require({IndicatorKind::EMA, 10});
+    double alpha = 2.0 / 11.0;
+    double expected = 0.0;
+    for (std::size_t t = 0; t < ticks.size(); ++t) {
+        graph.update(ticks[t]);
+        expected = t == 0 ? mid(ticks[t]) : expected + alpha * (mid(ticks[t]) - expected);
+        assert(close(graph.value(node), expected));
+    }
+    std::cout << "Indicator EMA test passed\n";
+}
+
+void test_state_round_trip() {
+    auto ticks = make_ticks(120);
+    IndicatorGraph original("BTC/USD");
+    auto sma = original.require({IndicatorKind::SMA, 30});
+    auto ema = original.require({IndicatorKind::EMA, 8});
+    for (std::size_t t = 0; t < 70; ++t) {
+        original.update(ticks[t]);
+    }
+    std::stringstream state;
+    original.save_state(state);
+
+    IndicatorGraph restored("BTC/USD");
+    restored.require({IndicatorKind::SMA, 30});
+    restored.require({IndicatorKind::EMA, 8});
+    assert(restored.load_state(state));
+    for (std::size_t t = 70; t < ticks.size(); ++t) {
+        original.update(ticks[t]);
+        restored.update(ticks[t]);
+        assert(restored.value(sma) == original.value(sma));
+        assert(restored.value(ema) == original.value(ema));
+    }
+
+    // A graph with different nodes rejects the snapshot
+    std::stringstream again;
+    original.save_state(again);
+    IndicatorGraph other("BTC/USD");
+    other.require({IndicatorKind::SMA, 31});
+    other.require({IndicatorKind::EMA, 8});
+    assert(!other.load_state(again));
+    std::cout << "Indicator snapshot test passed\n";
+}
+
+int main() {
+    test_duplicate_specs_share_nodes();
+    test_sma_matches_naive();
+    test_longer_sma_registered_mid_stream();
+    test_ema_matches_naive();
+    test_state_round_trip();
+    return 0;
+}
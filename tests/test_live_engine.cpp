@@ -0,0 +1,173 @@
+#undef NDEBUG // Checks use assert and must run in every build type
+#include "data_manager.hpp"
+#include "divergence_tracker.hpp"
+#include "live_engine.hpp"
+#include "risk_manager.hpp"
+#include "strategy_framework.hpp"
+#include "trade_journal.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::string temp_path(const std::string& name) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("test_live_engine_" + name);
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+std::size_t count_kind(const TradeJournal& journal, JournalKind kind) {
+    std::size_t count = 0;
+    for (const JournalRecord& record : journal.records()) {
+        count += record.kind == kind;
+    }
+    return count;
+}
+
+bool near(double a, double b) {
+    return std::fabs(a - b) < 1e-9;
+}
+
+} // namespace
+
+void test_run_live_skips_hold() {
+    DataManager data_manager;
+    MovingAverage strategy(1, 2);
+    LiveEngine engine(data_manager, strategy);
+    RiskManager risk_manager;
+    TradeJournal journal;
+    assert(journal.open(temp_path("live.jnl")));
+    engine.attach_journal(&journal);
+    engine.attach_risk(&risk_manager);
+
+    // The simulated tick never moves, so both averages stay equal and the strategy holds
+    for (int i = 0; i < 3; ++i) {
+        engine.run_live("BTC/USD");
+    }
+    assert(engine.get_trades().empty());
+    assert(count_kind(journal, JournalKind::Order) == 3);
+    assert(count_kind(journal, JournalKind::Fill) == 0);
+    assert(risk_manager.get_exposure() == 0.0);
+    std::cout << "Live HOLD test passed\n";
+}
+
+void test_low_latency_skips_hold() {
+    DataManager data_manager;
+    const double bids[] = {100.0, 101.0, 102.0, 101.0}; // HOLD (warm-up), BUY, BUY, SELL
+    for (int i = 0; i < 4; ++i) {
+        data_manager.process_realtime_data({"2025-07-13 13:00:0" + std::to_string(i), "BTC/USD", bids[i], bids[i] + 10.0, 1.0});
+    }
+    MovingAverage strategy(1, 2);
+    LiveEngine engine(data_manager, strategy);
+    RiskManager risk_manager;
+    TradeJournal journal;
+    assert(journal.open(temp_path("low_latency.jnl")));
+    engine.attach_journal(&journal);
+
+    LowLatencyConfig config;
+    config.busy_poll = false;
+    config.lock_memory = false;
+    config.trade_capacity = 3; // Exactly the fills: a HOLD taking a slot would drop the SELL
+    engine.run_low_latency("BTC/USD", risk_manager, config);
+
+    const auto& trades = engine.get_trades();
+    assert(trades.size() == 3);
+    assert(trades[0].type == "BUY" && trades[2].type == "SELL");
+    assert(count_kind(journal, JournalKind::Order) == 4);
+    assert(count_kind(journal, JournalKind::Fill) == 3);
+    std::cout << "Low-latency HOLD test passed\n";
+}
+
+void test_live_fill_carries_slippage() {
+    DataManager data_manager;
+    MovingAverage strategy(1, 2);
+    MovingAverage shadow(1, 2);
+    DivergenceTracker tracker;
+    LiveEngine engine(data_manager, strategy);
+    TradeJournal journal;
+    assert(journal.open(temp_path("fill.jnl")));
+    engine.attach_journal(&journal);
+    engine.attach_shadow(&shadow, &tracker);
+
+    engine.run_live({"2025-07-13 13:00:00", "BTC/USD", 100.0, 110.0, 1.0}); // Warm-up HOLD
+    engine.run_live({"2025-07-13 13:00:01", "BTC/USD", 200.0, 210.0, 1.0}); // BUY at the 210 ask
+    assert(engine.get_trades().size() == 1);
+    double fill = engine.get_trades().back().price;
+    assert(near(fill, 210.0 * 1.001));
+
+    // The order keeps the quote; the journaled fill and the tracker see the slipped price
+    assert(journal.records().back().kind == JournalKind::Fill && journal.records().back().price == fill);
+    assert(journal.records()[journal.records().size() - 2].price == 210.0);
+    assert(near(tracker.last_slippage_bps(), 10.0));
+    assert(near(tracker.mean_price_delta_bps(), 10.0)); // Shadow fills at the quote
+    std::cout << "Live fill slippage test passed\n";
+}
+
+void test_deferred_alerts_are_raised_later() {
+    DivergenceThresholds thresholds;
+    thresholds.max_slippage_bps = 1.0;
+    DivergenceTracker tracker(thresholds);
+    std::size_t handled = 0;
+    tracker.set_alert_handler([&handled](const DivergenceAlert&) { ++handled; });
+    tracker.set_deferred(true);
+
+    MarketData tick{"2025-07-13 13:00:00", "BTC/USD", 100.0, 110.0, 1.0};
+    Order live{"BTC/USD", 111.0, 1.0, "BUY", tick.timestamp}; // ~91 bps over the ask
+    assert(tracker.on_tick(tick, live, live));
+    assert(handled == 0 && tracker.alerts().empty()); // Recorded only
+    assert(tracker.deferred_alerts().size() == 1);
+    DeferredAlert alert = tracker.deferred_alerts().front();
+    assert(!tracker.on_tick(tick, live, live)); // Still in breach: edge-triggered, nothing new
+    assert(tracker.deferred_alerts().empty());
+
+    tracker.raise_deferred(alert, tick.timestamp);
+    assert(handled == 1 && tracker.alerts().size() == 1);
+    assert(tracker.alerts().front().metric == "slippage_bps" && tracker.alerts().front().threshold == 1.0);
+    std::cout << "Deferred alert test passed\n";
+}
+
+void test_low_latency_raises_alerts_on_risk_thread() {
+    DataManager data_manager;
+    const double bids[] = {100.0, 101.0, 102.0, 101.0}; // HOLD (warm-up), BUY, BUY, SELL
+    for (int i = 0; i < 4; ++i) {
+        data_manager.process_realtime_data({"2025-07-13 13:00:0" + std::to_string(i), "BTC/USD", bids[i], bids[i] + 10.0, 1.0});
+    }
+    MovingAverage strategy(1, 2);
+    MovingAverage shadow(1, 2);
+    DivergenceThresholds thresholds;
+    thresholds.max_slippage_bps = 1.0; // The fill model's 10 bps breaches on the first fill
+    DivergenceTracker tracker(thresholds);
+    std::vector<std::thread::id> handler_threads;
+    tracker.set_alert_handler([&handler_threads](const DivergenceAlert&) { handler_threads.push_back(std::this_thread::get_id()); });
+    LiveEngine engine(data_manager, strategy);
+    engine.attach_shadow(&shadow, &tracker);
+    RiskManager risk_manager;
+
+    LowLatencyConfig config;
+    config.busy_poll = false;
+    config.lock_memory = false;
+    engine.run_low_latency("BTC/USD", risk_manager, config);
+
+    assert(!tracker.alerts().empty() && handler_threads.size() == tracker.alerts().size());
+    assert(tracker.alerts().front().metric == "slippage_bps");
+    assert(tracker.alerts().front().timestamp == "2025-07-13 13:00:01"); // The tick that breached
+    assert(handler_threads.front() != std::this_thread::get_id());
+    assert(tracker.deferred_alerts().empty()); // Deferral ends with the run
+
+    std::cout << "Low-latency deferred alert test passed\n";
+}
+
+int main() {
+    test_run_live_skips_hold();
+    test_low_latency_skips_hold();
+    test_live_fill_carries_slippage();
+    test_deferred_alerts_are_raised_later();
+    test_low_latency_raises_alerts_on_risk_thread();
+    return 0;
+}
@@ -0,0 +1,102 @@
+#undef NDEBUG // Checks use assert and must run in every build type
+#include "performance_analytics.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+Order order(const char* type, double price) {
+    return {"BTC/USD", price, 1.0, type, "2025-07-12 13:00:00"};
+}
+
+// Deterministic, autocorrelated-looking per-tick returns
+std::vector<double> make_returns(std::size_t count) {
+    std::vector<double> returns;
+    std::uint32_t state = 2024;
+    double drift = 0.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        state = state * 1664525u + 1013904223u;
+        drift = 0.8 * drift + (static_cast<double>(state >> 8) / 16777216.0 - 0.5) * 0.004;
+        returns.push_back(drift);
+    }
+    return returns;
+}
+
+bool near(double a, double b) {
+    return std::fabs(a - b) < 1e-12;
+}
+
+bool same_band(const PercentileBand& a, const PercentileBand& b) {
+    return a.p5 == b.p5 && a.p50 == b.p50 && a.p95 == b.p95;
+}
+
+bool same_report(const RobustnessReport& a, const RobustnessReport& b) {
+    return same_band(a.sharpe, b.sharpe) && same_band(a.max_drawdown, b.max_drawdown) &&
+           same_band(a.total_return, b.total_return) && a.resamples == b.resamples;
+}
+
+} // namespace
+
+void test_position_book_marks_to_mid() {
+    PositionBook book;
+    book.reset(100.0);
+    double ret = 0.0;
+    assert(!book.on_tick(order("HOLD", 101.0), 100.0, ret)); // First mark: no return yet
+    assert(book.equity == 100.0);
+
+    assert(book.on_tick(order("BUY", 101.0), 100.0, ret)); // Long one unit at the ask, marked at mid
+    assert(book.position == 1.0 && book.cash == -101.0 && near(ret, -0.01));
+    assert(book.on_tick(order("HOLD", 111.0), 110.0, ret)); // HOLD keeps the position
+    assert(book.position == 1.0 && near(ret, 10.0 / 99.0));
+    assert(book.on_tick(order("BUY", 111.0), 110.0, ret)); // Already long: no trade
+    assert(book.trades == 1 && ret == 0.0);
+
+    assert(book.on_tick(order("SELL", 109.0), 110.0, ret)); // Long to short: sells two units at the bid
+    assert(book.position == -1.0 && book.cash == -101.0 + 218.0 && book.trades == 2);
+    assert(book.on_tick(order("HOLD", 99.0), 100.0, ret)); // Short gains as the mid falls
+    assert(book.equity == 100.0 + 117.0 - 100.0 && ret > 0.0);
+    assert(book.acc.count() == 5);
+    std::cout << "Position book test passed\n";
+}
+
+void test_bootstrap_is_independent_of_thread_count() {
+    std::vector<double> returns = make_returns(300);
+    PerformanceAnalytics analytics;
+    for (ResampleMethod method : {ResampleMethod::BlockBootstrap, ResampleMethod::TradeShuffle}) {
+        RobustnessConfig config;
+        config.method = method;
+        config.resamples = 501; // Not a multiple of the thread counts below
+        config.seed = 7;
+        config.threads = 1;
+        RobustnessReport single = analytics.analyze_robustness(returns, config);
+        assert(single.resamples == 501);
+        assert(single.sharpe.p5 <= single.sharpe.p50 && single.sharpe.p50 <= single.sharpe.p95);
+        for (unsigned threads : {2u, 3u, 8u}) {
+            config.threads = threads;
+            assert(same_report(analytics.analyze_robustness(returns, config), single));
+        }
+
+        config.seed = 8; // A different seed draws different resamples
+        config.threads = 1;
+        assert(!same_band(analytics.analyze_robustness(returns, config).max_drawdown, single.max_drawdown));
+    }
+    std::cout << "Bootstrap thread independence test passed\n";
+}
+
+void test_bootstrap_needs_returns() {
+    PerformanceAnalytics analytics;
+    std::vector<double> one = {0.01};
+    assert(analytics.analyze_robustness(one, RobustnessConfig{}).resamples == 0);
+    std::cout << "Bootstrap input check test passed\n";
+}
+
+int main() {
+    test_position_book_marks_to_mid();
+    test_bootstrap_is_independent_of_thread_count();
+    test_bootstrap_needs_returns();
+    return 0;
+}
@@ -0,0 +1,133 @@
+#undef NDEBUG // Checks use assert and must run in every build type
+#include "data_manager.hpp"
+#include "portfolio_backtest.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+MarketData tick(const std::string& asset, const std::string& timestamp, double bid) {
+    return {timestamp, asset, bid, bid + 10.0, 1000.0};
+}
+
+// cash + sum(position * mark), recomputed from scratch
+double naive_equity(const PortfolioLedger& ledger) {
+    double equity = ledger.cash();
+    for (std::size_t id = 0; id < ledger.asset_count(); ++id) {
+        equity += ledger.position(id) * ledger.mark_price(id);
+    }
+    return equity;
+}
+
+// Replays a fixed script of signed quantities, one per merged tick
+class ScriptedStrategy : public PortfolioStrategy {
+public:
+    explicit ScriptedStrategy(std::vector<double> quantities) : quantities_(std::move(quantities)) {}
+    Order on_tick(std::size_t, const MarketData& data, const PortfolioLedger&) override {
+        double quantity = next_ < quantities_.size() ? quantities_[next_++] : 0.0;
+        const char* type = quantity > 0.0 ? "BUY" : quantity < 0.0 ? "SELL" : "HOLD";
+        return {data.asset, quantity > 0.0 ? data.ask : data.bid, std::fabs(quantity), type, data.timestamp};
+    }
+
+private:
+    std::vector<double> quantities_;
+    std::size_t next_ = 0;
+};
+
+} // namespace
+
+void test_merge_order_with_ties() {
+    std::vector<MarketData> btc = {tick("BTC/USD", "2025-07-12 13:00:00", 1), tick("BTC/USD", "2025-07-12 13:00:02", 2),
+                                   tick("BTC/USD", "2025-07-12 13:00:02", 3)};
+    std::vector<MarketData> eth = {tick("ETH/USD", "2025-07-12 13:00:01", 4), tick("ETH/USD", "2025-07-12 13:00:02", 5)};
+    std::vector<MarketData> sol = {tick("SOL/USD", "2025-07-12 13:00:00", 6)};
+    std::vector<MarketData> empty;
+    MergedTickStream stream({std::span<const MarketData>(sol), std::span<const MarketData>(empty),
+                             std::span<const MarketData>(btc), std::span<const MarketData>(eth)});
+    assert(stream.total_ticks() == 6);
+
+    // Timestamp order; equal timestamps go to the lower asset id, and one asset's ticks keep
+    // their own order
+    const double expected_bids[] = {6, 1, 4, 2, 3, 5};
+    const std::size_t expected_ids[] = {0, 2, 3, 2, 2, 3};
+    std::size_t asset_id = 0;
+    const MarketData* data = nullptr;
+    for (std::size_t i = 0; i < 6; ++i) {
+        assert(stream.next(asset_id, data));
+        assert(asset_id == expected_ids[i] && data->bid == expected_bids[i]);
+    }
+    assert(!stream.next(asset_id, data));
+    std::cout << "Portfolio merge order test passed\n";
+}
+
+void test_incremental_equity_matches_naive() {
+    PortfolioLedger ledger;
+    ledger.reset(3, 1000000.0);
+    std::uint32_t state = 777;
+    auto random = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    };
+    for (int step = 0; step < 5000; ++step) {
+        std::size_t id = random() % 3;
+        double price = 100.0 + static_cast<double>(random() % 10000) / 10.0;
+        ledger.mark(id, price);
+        double quantity = static_cast<double>(random() % 7) - 3.0;
+        ledger.fill(id, quantity, price + static_cast<double>(random() % 5) - 2.0); // Some fills are rejected
+        assert(std::fabs(ledger.equity() - naive_equity(ledger)) <= 1e-9 * std::fabs(naive_equity(ledger)));
+    }
+    std::cout << "Portfolio equity invariant test passed\n";
+}
+
+void test_ledger_rejections() {
+    PortfolioLedger ledger;
+    ledger.reset(2, 1000.0);
+    ledger.mark(0, 100.0);
+    ledger.mark(1, 50.0);
+
+    assert(!ledger.fill(0, 11.0, 100.0)); // Costs 1100 with 1000 cash
+    assert(ledger.cash() == 1000.0 && ledger.position(0) == 0.0);
+    assert(!ledger.fill(1, -1.0, 50.0)); // Naked short
+    assert(ledger.cash() == 1000.0 && ledger.position(1) == 0.0);
+
+    assert(ledger.fill(0, 10.0, 100.0)); // Exactly all the cash
+    assert(ledger.cash() == 0.0 && ledger.position(0) == 10.0);
+    assert(!ledger.fill(1, 1.0, 50.0)); // Shared cash is spent: the other asset cannot buy
+    assert(!ledger.fill(0, -11.0, 100.0)); // More than the position
+    assert(ledger.fill(0, -10.0, 100.0));
+    assert(ledger.cash() == 1000.0 && ledger.position(0) == 0.0 && ledger.equity() == 1000.0);
+    std::cout << "Portfolio ledger rejection test passed\n";
+}
+
+void test_backtest_counts_rejections() {
+    DataManager data_manager;
+    data_manager.process_realtime_data(tick("BTC/USD", "2025-07-12 13:00:00", 100.0));
+    data_manager.process_realtime_data(tick("ETH/USD", "2025-07-12 13:00:01", 50.0));
+    data_manager.process_realtime_data(tick("BTC/USD", "2025-07-12 13:00:02", 120.0));
+    data_manager.process_realtime_data(tick("ETH/USD", "2025-07-12 13:00:03", 55.0));
+
+    // BTC buy 2 @ 110, ETH sell 1 (nothing held), BTC buy 1 (cash spent), ETH buy 1 (cash spent)
+    ScriptedStrategy strategy({2.0, -1.0, 1.0, 1.0});
+    PortfolioBacktest backtest(data_manager, strategy);
+    backtest.run({"BTC/USD", "ETH/USD"}, 250.0);
+    assert(backtest.fills() == 1 && backtest.rejected() == 3);
+    assert(backtest.ledger().position(0) == 2.0 && backtest.ledger().cash() == 30.0);
+    assert(backtest.equity_curve().size() == 4);
+    assert(backtest.equity_curve().back() == naive_equity(backtest.ledger()));
+    std::cout << "Portfolio backtest rejection test passed\n";
+}
+
+int main() {
+    test_merge_order_with_ties();
+    test_incremental_equity_matches_naive();
+    test_ledger_rejections();
+    test_backtest_counts_rejections();
+    return 0;
+}
@@ -0,0 +1,73 @@
+#undef NDEBUG // Checks use assert and must run in every build type
+#include "run_results.hpp"
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace {
+
+Order make_order(int i, const std::string& type) {
+    return {"BTC/USD", 50000.0 + i, 1.0, type, "2025-07-13 13:00:" + std::to_string(10 + i % 50)};
+}
+
+// One run of count trades into fresh columns that start with room for a single trade
+TradeView fill_run(RunArena& arena, TradeColumns& columns, int count) {
+    arena.reset();
+    columns.begin(arena, "BTC/USD", 1);
+    for (int i = 0; i < count; ++i) {
+        columns.push(make_order(i, i % 2 ? "SELL" : "BUY"));
+    }
+    return columns.view();
+}
+
+} // namespace
+
+void test_arena_reuses_blocks_across_resets() {
+    RunArena arena(4096);
+    TradeColumns columns;
+    const double* first = fill_run(arena, columns, 500).price.data(); // Grows the columns several times
+    std::size_t reserved = arena.bytes_reserved();
+    assert(reserved > 0);
+    for (int run = 0; run < 20; ++run) {
+        // Same blocks, same bump sequence: no new blocks and the results land at the same address
+        assert(fill_run(arena, columns, 500).price.data() == first);
+        assert(arena.bytes_reserved() == reserved);
+    }
+    std::cout << "Arena reuse test passed\n";
+}
+
+void test_columns_grow_and_keep_rows() {
+    RunArena arena(256); // Small blocks: growth also spills into dedicated blocks
+    TradeColumns columns;
+    TradeView view = fill_run(arena, columns, 1000);
+    assert(view.size() == 1000 && view.asset == "BTC/USD");
+    for (std::size_t i = 0; i < view.size(); ++i) {
+        Order expected = make_order(static_cast<int>(i), i % 2 ? "SELL" : "BUY");
+        assert(view.price[i] == expected.price);
+        assert(view.side[i] == (i % 2 ? TradeSide::Sell : TradeSide::Buy));
+        assert(view.timestamp[i] == expected.timestamp);
+    }
+    std::cout << "Column growth test passed\n";
+}
+
+void test_hold_is_not_recorded() {
+    RunArena arena;
+    TradeColumns columns;
+    columns.begin(arena, "BTC/USD", 4);
+    columns.push(make_order(0, "HOLD"));
+    columns.push(make_order(1, "BUY"));
+    columns.push(make_order(2, "HOLD"));
+    columns.push(make_order(3, "SELL"));
+    TradeView view = columns.view();
+    assert(view.size() == 2);
+    assert(view.to_trade(0).type == "BUY" && view.to_trade(1).type == "SELL");
+    std::cout << "HOLD skip test passed\n";
+}
+
+int main() {
+    test_arena_reuses_blocks_across_resets();
+    test_columns_grow_and_keep_rows();
+    test_hold_is_not_recorded();
+    return 0;
+}
@@ -0,0 +1,118 @@
+#undef NDEBUG // Checks use assert and must run in every build type
+#include "live_engine.hpp"
+#include "risk_manager.hpp"
+#include "strategy_framework.hpp"
+#include "strategy_scheduler.hpp"
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+MarketData tick(const std::string& asset, const std::string& timestamp, double bid) {
+    return {timestamp, asset, bid, bid + 10.0, 1000.0};
+}
+
+// Records "asset@timestamp" for every tick of one asset
+StrategyScheduler::Task record_ticks(StrategyScheduler& scheduler, std::string asset, std::vector<std::string>& seen) {
+    while (true) {
+        const MarketData& data = co_await scheduler.next_tick(asset);
+        seen.push_back(data.asset + "@" + data.timestamp);
+    }
+}
+
+// Wakes at a deadline, then immediately awaits a deadline that is already due
+StrategyScheduler::Task rearm_timer(StrategyScheduler& scheduler, std::string deadline, int& fired) {
+    while (true) {
+        co_await scheduler.wait_until(deadline);
+        ++fired;
+    }
+}
+
+} // namespace
+
+void test_out_of_order_publish() {
+    StrategyScheduler scheduler;
+    std::vector<std::string> seen;
+    scheduler.spawn(record_ticks(scheduler, "BTC/USD", seen));
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:02", 100.0));
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:00", 101.0));
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:01", 102.0));
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:01", 103.0)); // Tie: publish order
+    assert(scheduler.run() == 4);
+    assert((seen == std::vector<std::string>{"BTC/USD@2025-07-12 13:00:00", "BTC/USD@2025-07-12 13:00:01",
+                                             "BTC/USD@2025-07-12 13:00:01", "BTC/USD@2025-07-12 13:00:02"}));
+    std::cout << "Scheduler ordering test passed\n";
+}
+
+void test_per_asset_dispatch() {
+    StrategyScheduler scheduler;
+    std::vector<std::string> btc;
+    std::vector<std::string> eth;
+    scheduler.spawn(record_ticks(scheduler, "BTC/USD", btc));
+    scheduler.spawn(record_ticks(scheduler, "ETH/USD", eth));
+    scheduler.publish(tick("ETH/USD", "2025-07-12 13:00:01", 3000.0));
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:00", 50000.0));
+    scheduler.publish(tick("SOL/USD", "2025-07-12 13:00:02", 150.0)); // No waiter: dispatched, ignored
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:03", 50001.0));
+    assert(scheduler.run() == 4);
+    assert((btc == std::vector<std::string>{"BTC/USD@2025-07-12 13:00:00", "BTC/USD@2025-07-12 13:00:03"}));
+    assert((eth == std::vector<std::string>{"ETH/USD@2025-07-12 13:00:01"}));
+    std::cout << "Scheduler per-asset dispatch test passed\n";
+}
+
+void test_timers() {
+    StrategyScheduler scheduler;
+    int fired = 0;
+    scheduler.spawn(rearm_timer(scheduler, "2025-07-12 13:00:01", fired));
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:00", 100.0));
+    scheduler.run();
+    assert(fired == 0); // Deadline not reached
+
+    // The timer re-awaits an already-due deadline: once per tick, never a loop within one tick
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:01", 100.0));
+    scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:02", 100.0));
+    assert(scheduler.run() == 2);
+    assert(fired == 2);
+    std::cout << "Scheduler timer test passed\n";
+}
+
+void test_hosted_strategies_keep_own_fills() {
+    DataManager data_manager;
+    MovingAverage engine_strategy(1, 2);
+    MovingAverage fast(1, 2);
+    MovingAverage slow(2, 3);
+    LiveEngine engine(data_manager, engine_strategy);
+    RiskManager risk_manager;
+    engine.attach_risk(&risk_manager);
+
+    StrategyScheduler scheduler;
+    auto fast_id = engine.host(scheduler, "BTC/USD", fast);
+    auto slow_id = engine.host(scheduler, "BTC/USD", slow);
+    const double bids[] = {100.0, 101.0, 102.0, 101.0};
+    for (int i = 0; i < 4; ++i) {
+        scheduler.publish(tick("BTC/USD", "2025-07-12 13:00:0" + std::to_string(i), bids[i]));
+    }
+    scheduler.run();
+
+    // Warm-up HOLDs are not fills: MA(1, 2) trades from the 2nd tick, MA(2, 3) from the 3rd
+    const HostedStrategy& fast_state = engine.hosted(fast_id);
+    const HostedStrategy& slow_state = engine.hosted(slow_id);
+    assert(fast_state.trades.size() == 3 && fast_state.trades.front().type == "BUY");
+    assert(fast_state.trades.back().type == "SELL");
+    assert(slow_state.trades.size() == 2);
+    for (const auto& trade : fast_state.trades) {
+        assert(trade.type != "HOLD");
+    }
+    assert(engine.get_trades().empty()); // Hosted fills are kept out of the engine's own trades
+    std::cout << "Hosted strategy test passed\n";
+}
+
+int main() {
+    test_out_of_order_publish();
+    test_per_asset_dispatch();
+    test_timers();
+    test_hosted_strategies_keep_own_fills();
+    return 0;
+}
@@ -0,0 +1,210 @@
+#undef NDEBUG // Checks use assert and must run in every build type
+#include "divergence_tracker.hpp"
+#include "live_engine.hpp"
+#include "risk_manager.hpp"
+#include "strategy_framework.hpp"
+#include "trade_journal.hpp"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+std::string temp_path(const std::string& name) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("test_trade_journal_" + name);
+    std::filesystem::remove(path);
+    std::filesystem::remove(path.string() + ".snap");
+    return path.string();
+}
+
+Order make_order(int i) {
+    return {"BTC/USD", 50000.0 + i, 1.0, i % 2 ? "SELL" : "BUY", "2025-07-13 13:00:" + std::to_string(10 + i)};
+}
+
+// Fill a journal sized for exactly count records, so the last record ends the file
+void write_records(const std::string& path, int count) {
+    TradeJournal journal;
+    assert(journal.open(path, count));
+    for (int i = 0; i < count; ++i) {
+        assert(journal.append_order(make_order(i)));
+    }
+    assert(journal.last_seq() == static_cast<std::uint64_t>(count));
+}
+
+// Overwrite bytes of record index (0-based) at offset within the record
+void patch_record(const std::string& path, int index, std::size_t offset, const void* bytes, std::size_t size) {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(static_cast<std::streamoff>(64 + index * sizeof(JournalRecord) + offset));
+    file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+}
+
+} // namespace
+
+void test_reopen_finds_tail() {
+    std::string path = temp_path("reopen.jnl");
+    write_records(path, 1000);
+    TradeJournal journal;
+    assert(journal.open(path));
+    assert(journal.last_seq() == 1000);
+    Trade last = TradeJournal::to_trade(journal.records().back());
+    assert(last.price == 50999.0 && last.type == "SELL");
+    assert(journal.records_after(990).size() == 10);
+    std::cout << "Journal reopen test passed\n";
+}
+
+void test_growth_keeps_records() {
+    std::string path = temp_path("growth.jnl");
+    {
+        TradeJournal journal;
+        assert(journal.open(path, 4));
+        for (int i = 0; i < 37; ++i) {
+            assert(journal.append_order(make_order(i)));
+        }
+    }
+    TradeJournal journal;
+    assert(journal.open(path));
+    assert(journal.last_seq() == 37);
+    std::cout << "Journal growth test passed\n";
+}
+
+void test_torn_payload_is_dropped() {
+    std::string path = temp_path("torn.jnl");
+    write_records(path, 100);
+    double garbage = -1.0; // seq landed but the price did not: checksum no longer matches
+    patch_record(path, 99, offsetof(JournalRecord, price), &garbage, sizeof(garbage));
+
+    TradeJournal journal;
+    assert(journal.open(path));
+    assert(journal.last_seq() == 99);
+
+    // The next append reuses the torn slot and continues the sequence
+    assert(journal.append_order(make_order(1000)));
+    assert(journal.last_seq() == 100);
+    assert(journal.records().back().price == 51000.0);
+    std::cout << "Journal torn record test passed\n";
+}
+
+void test_unpublished_seq_is_dropped() {
+    std::string path = temp_path("unpublished.jnl");
+    write_records(path, 100);
+    std::uint64_t zero = 0; // Payload written, crash before seq was published
+    patch_record(path, 99, offsetof(JournalRecord, seq), &zero, sizeof(zero));
+
+    TradeJournal journal;
+    assert(journal.open(path));
+    assert(journal.last_seq() == 99);
+    std::cout << "Journal unpublished seq test passed\n";
+}
+
+void test_truncated_file() {
+    std::string path = temp_path("truncated.jnl");
+    write_records(path, 100);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 10); // Last record cut short
+
+    TradeJournal journal;
+    assert(journal.open(path));
+    assert(journal.last_seq() == 99);
+    std::cout << "Journal truncated file test passed\n";
+}
+
+void test_file_cut_inside_first_record() {
+    std::string path = temp_path("first_record.jnl");
+    write_records(path, 1);
+    std::filesystem::resize_file(path, 64 + 40); // Header plus half of the only record
+
+    TradeJournal journal;
+    assert(journal.open(path));
+    assert(journal.last_seq() == 0);
+    for (int i = 0; i < 5; ++i) { // Reuses the torn slot, then grows past it
+        assert(journal.append_order(make_order(i)));
+    }
+    assert(journal.last_seq() == 5);
+    assert(journal.records().front().price == 50000.0);
+    std::cout << "Journal first-record truncation test passed\n";
+}
+
+void test_snapshot_round_trip() {
+    std::string path = temp_path("snapshot.jnl");
+    std::string snapshot = path + ".snap";
+    DataManager data_manager;
+    MarketData higher{"2025-07-13 13:05:00", "BTC/USD", 50100.0, 50110.0, 1000.0};
+
+    // Reference strategy fed the same ticks without interruption
+    MovingAverage expected(2, 3);
+    for (int i = 0; i < 3; ++i) {
+        expected.execute({"2025-07-13 13:00:00", "BTC/USD", 50000.0, 50010.0, 1000.0});
+    }
+    expected.execute(higher);
+
+    double exposure = 0.0;
+    double pnl = 0.0;
+    {
+        MovingAverage strategy(2, 3);
+        MovingAverage shadow(2, 3);
+        DivergenceTracker tracker;
+        LiveEngine engine(data_manager, strategy);
+        RiskManager risk_manager;
+        TradeJournal journal;
+        assert(journal.open(path));
+        engine.attach_journal(&journal);
+        engine.attach_risk(&risk_manager);
+        engine.attach_shadow(&shadow, &tracker);
+        for (int i = 0; i < 3; ++i) {
+            engine.run_live("BTC/USD"); // Flat ticks: both averages equal, the strategy holds
+        }
+        assert(engine.save_snapshot(snapshot, risk_manager));
+        engine.run_live(higher); // Journaled after the snapshot: a BUY, replayed on recovery
+        assert(engine.get_trades().size() == 1);
+        exposure = risk_manager.get_exposure();
+        pnl = engine.get_pnl();
+    }
+    assert(exposure != 0.0);
+
+    MovingAverage strategy(2, 3);
+    MovingAverage shadow(2, 3);
+    DivergenceTracker tracker;
+    LiveEngine engine(data_manager, strategy);
+    RiskManager risk_manager;
+    TradeJournal journal;
+    assert(journal.open(path));
+    engine.attach_journal(&journal);
+    engine.attach_shadow(&shadow, &tracker);
+    assert(engine.recover(snapshot, risk_manager));
+    assert(risk_manager.get_exposure() == exposure);
+    assert(engine.get_pnl() == pnl);
+
+    // Live and shadow averages include the post-snapshot tick, as if the engine never stopped
+    std::stringstream expected_state;
+    std::stringstream live_state;
+    std::stringstream shadow_state;
+    expected.save_state(expected_state);
+    strategy.save_state(live_state);
+    shadow.save_state(shadow_state);
+    assert(live_state.str() == expected_state.str());
+    assert(shadow_state.str() == expected_state.str());
+    engine.run_live(higher);
+    assert(tracker.signal_mismatches() == 0);
+
+    // A snapshot taken with other window lengths is rejected
+    MovingAverage other(3, 5);
+    LiveEngine other_engine(data_manager, other);
+    RiskManager other_risk;
+    assert(!other_engine.recover(snapshot, other_risk));
+    std::cout << "Journal snapshot round-trip test passed\n";
+}
+
+int main() {
+    test_reopen_finds_tail();
+    test_growth_keeps_records();
+    test_torn_payload_is_dropped();
+    test_unpublished_seq_is_dropped();
+    test_truncated_file();
+    test_file_cut_inside_first_record();
+    test_snapshot_round_trip();
+    return 0;
+}